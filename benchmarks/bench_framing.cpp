@@ -0,0 +1,47 @@
+// benchmarks/bench_framing.cpp
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "utils.hpp"
+#include "header.hpp"
+
+namespace {
+
+// 본문 크기별 프레임 생성 (8바이트 헤더 + 8바이트 배수 패딩)
+void BM_CreateResponseString(benchmark::State& state)
+{
+    const std::string body(static_cast<std::size_t>(state.range(0)), 'x');
+    for (auto _ : state) {
+        auto frame = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_MOVED, body);
+        benchmark::DoNotOptimize(frame);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_CreateResponseString)->Arg(16)->Arg(64)->Arg(256)->Arg(4096);
+
+// 프레임 해석: Connection 수신 경로와 동일 (헤더 memcpy + 타입 검사 → 패딩 제거한 본문 복사)
+void BM_ParseFrame(benchmark::State& state)
+{
+    const std::string body(static_cast<std::size_t>(state.range(0)), 'x');
+    const std::string frame = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_MOVED, body);
+    const std::vector<char> buffer(frame.begin(), frame.end());
+
+    for (auto _ : state) {
+        Header header;
+        std::memcpy(&header, buffer.data(), sizeof(Header));
+        if (header.main_type != MainEventType::GAME || header.sub_type < 201 || header.sub_type > 299) {
+            state.SkipWithError("invalid header");
+            break;
+        }
+        std::vector<char> actual_data(buffer.begin() + sizeof(Header),
+                                      buffer.begin() + sizeof(Header) + header.body_length);
+        benchmark::DoNotOptimize(actual_data.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(frame.size()));
+}
+BENCHMARK(BM_ParseFrame)->Arg(16)->Arg(64)->Arg(256)->Arg(4096);
+
+} // namespace
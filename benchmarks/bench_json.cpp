@@ -0,0 +1,118 @@
+// benchmarks/bench_json.cpp
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "room.hpp"
+#include "map.hpp"
+#include "player.hpp"
+
+namespace {
+
+constexpr int kPlayers = 8; // 방 하나 기준 플레이어 수
+
+/**
+ * 메시지 종류별 예시 (핸들러가 만드는 것과 같은 형태)
+ *  - room_create / come_in_map / snapshot / terrain_chunk / player_finished 는 실제 Room / Map 으로 생성
+ */
+const nlohmann::json& sample_message(const std::string& type)
+{
+    static const std::map<std::string, nlohmann::json> messages = []() {
+        std::map<std::string, nlohmann::json> m;
+
+        auto room = std::make_shared<Room>(1);
+        room->initialize_maps();
+        std::shared_ptr<Player> first;
+        for (int i = 0; i < kPlayers; ++i) {
+            auto player = std::make_shared<Player>("bench" + std::to_string(i));
+            room->join_player(player);
+            room->gr_.add_player_result(player, i);
+            if (!first) first = player;
+        }
+        auto map = room->get_map_by_name("A");
+
+        nlohmann::json snapshot_players = nlohmann::json::array();
+        for (const auto& p : map->get_players()) {
+            auto entry = room->player_position_info(*p);
+            entry["seq"] = 42;
+            snapshot_players.push_back(entry);
+        }
+
+        map->build_terrain_chunks(4);
+        nlohmann::json chunks = nlohmann::json::array();
+        for (int chunk : map->get_chunks_around(map->start_point)) {
+            chunks.push_back(map->extract_chunk_info(chunk));
+        }
+
+        m["join"] = {{"action", "join"}, {"player_id", first->id_}, {"result", true}};
+        m["ping"] = {{"action", "ping"}, {"seq", 7}};
+        m["room_create"] = room->extract_all_map_info(true);
+        m["count_down"] = {{"action", "count_down"}, {"result", true}, {"count", "3"}};
+        m["game_start"] = {{"action", "game_start"}, {"result", true}};
+        m["move_request"] = {{"x", 2}, {"y", 1}, {"seq", 42}};
+        m["player_moved"] = {{"action", "player_moved"}, {"result", true}, {"player_id", first->id_},
+                             {"x", 2}, {"y", 1}, {"map", "A"}};
+        m["move_ack"] = {{"action", "move_ack"}, {"seq", 42}};
+        m["come_in_map"] = {{"action", "player_come_in_map"}, {"result", true}, {"player_id", first->id_},
+                            {"map", "A"}, {"x", 1}, {"y", 1}, {"players", room->players_position_info(*map)}};
+        m["come_out_map"] = {{"action", "player_come_out_map"}, {"result", true}, {"player_id", first->id_}, {"map", "A"}};
+        m["snapshot"] = {{"action", "snapshot"}, {"result", true}, {"tick", 100}, {"map", "A"}, {"players", snapshot_players}};
+        m["terrain_chunk"] = {{"action", "terrain_chunk"}, {"result", true}, {"map", "A"}, {"chunks", chunks}};
+        m["player_finished"] = room->gr_.to_json();
+        m["player_finished"]["action"] = "player_finished";
+        m["player_finished"]["result"] = true;
+        m["player_finished"]["player_id"] = first->id_;
+        m["player_finished"]["player_name"] = first->name_;
+        m["game_end"] = {{"action", "game_end"}, {"result", true}, {"reason", "finished"}};
+        m["move_rejected"] = {{"action", "player_moved"}, {"result", false}, {"player_id", first->id_},
+                              {"x", 1}, {"y", 1}, {"map", "A"}, {"seq", 41}, {"rejected_seq", 42}};
+        return m;
+    }();
+    return messages.at(type);
+}
+
+void BM_JsonEncode(benchmark::State& state, const char* type)
+{
+    const auto& msg = sample_message(type);
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        std::string body = msg.dump();
+        bytes += body.size();
+        benchmark::DoNotOptimize(body);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+void BM_JsonDecode(benchmark::State& state, const char* type)
+{
+    const std::string body = sample_message(type).dump();
+    for (auto _ : state) {
+        auto parsed = nlohmann::json::parse(body);
+        benchmark::DoNotOptimize(parsed);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(body.size()));
+}
+
+#define BENCHMARK_MESSAGE(type)                       \
+    BENCHMARK_CAPTURE(BM_JsonEncode, type, #type);    \
+    BENCHMARK_CAPTURE(BM_JsonDecode, type, #type)
+
+BENCHMARK_MESSAGE(join);
+BENCHMARK_MESSAGE(ping);
+BENCHMARK_MESSAGE(room_create);
+BENCHMARK_MESSAGE(count_down);
+BENCHMARK_MESSAGE(game_start);
+BENCHMARK_MESSAGE(move_request);
+BENCHMARK_MESSAGE(player_moved);
+BENCHMARK_MESSAGE(move_ack);
+BENCHMARK_MESSAGE(come_in_map);
+BENCHMARK_MESSAGE(come_out_map);
+BENCHMARK_MESSAGE(snapshot);
+BENCHMARK_MESSAGE(terrain_chunk);
+BENCHMARK_MESSAGE(player_finished);
+BENCHMARK_MESSAGE(game_end);
+BENCHMARK_MESSAGE(move_rejected);
+
+} // namespace
@@ -0,0 +1,68 @@
+// benchmarks/bench_lookup.cpp
+
+#include <benchmark/benchmark.h>
+#include <boost/asio.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "connection_manager.hpp"
+#include "game_manager.hpp"
+
+namespace {
+
+// 플레이어 수별 커넥션 ↔ 플레이어 조회 (싱글톤이므로 측정 후 등록 해제)
+void BM_ConnectionManagerLookup(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    boost::asio::io_context io;
+    auto& manager = ConnectionManager::get_instance();
+
+    std::vector<std::shared_ptr<Connection>> connections;
+    std::vector<std::shared_ptr<Player>> players;
+    connections.reserve(count);
+    players.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto conn = std::make_shared<Connection>(boost::asio::ip::tcp::socket(io));
+        auto player = std::make_shared<Player>("bench" + std::to_string(i));
+        manager.add_connection(conn);
+        manager.register_connection(player, conn);
+        connections.push_back(std::move(conn));
+        players.push_back(std::move(player));
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.get_player_for_connection(connections[i]));
+        benchmark::DoNotOptimize(manager.get_connection_for_player(players[i]));
+        if (++i == count) i = 0;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2);
+
+    for (std::size_t k = 0; k < count; ++k) {
+        manager.unregister_connection(players[k]);
+        manager.remove_connection(connections[k]);
+    }
+}
+BENCHMARK(BM_ConnectionManagerLookup)->Arg(10)->Arg(1000)->Arg(100000);
+
+// 방 수별 find_room (슬롯 핸들 → 인덱스 + 세대 비교)
+void BM_GameManagerFindRoom(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    GameManager manager;
+    std::vector<uint64_t> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ids.push_back(manager.create_room()->id_);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.find_room(ids[i]));
+        if (++i == count) i = 0;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_GameManagerFindRoom)->Arg(10)->Arg(1000)->Arg(100000);
+
+} // namespace
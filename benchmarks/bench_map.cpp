@@ -0,0 +1,62 @@
+// benchmarks/bench_map.cpp
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "map.hpp"
+
+namespace {
+
+// 포탈 맵 (서버 맵과 같은 형태: 시작 (1,1), 포탈 하나)
+std::unique_ptr<Map> make_portal_map(int size)
+{
+    auto map = std::make_unique<Map>("A", size, size);
+    map->start_point = {1, 1};
+    map->portals_.push_back({{size / 2, size / 2}, "B", "B"});
+    return map;
+}
+
+// 맵 크기별 장애물(미로) 생성 (경로 연결 검증 포함)
+void BM_GenerateRandomObstacles(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        auto map = make_portal_map(size);
+        map->generate_random_obstacles(false);
+        benchmark::DoNotOptimize(map->obstacles_.data());
+    }
+}
+BENCHMARK(BM_GenerateRandomObstacles)->Arg(10)->Arg(20)->Arg(40)->Unit(benchmark::kMicrosecond);
+
+// 생성된 맵에서 시작점 → 포탈 경로 확인 (BFS)
+void BM_IsPathsConnected(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    auto map = make_portal_map(size);
+    map->generate_random_obstacles(false);
+    const Point target = map->portals_.front().position;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map->is_paths_connected(map->start_point, target));
+    }
+}
+BENCHMARK(BM_IsPathsConnected)->Arg(10)->Arg(20)->Arg(40)->Unit(benchmark::kMicrosecond);
+
+// 이동 검증: 맵의 모든 칸에 대해 is_valid_position (장애물 수에 비례)
+void BM_IsValidPosition(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    auto map = make_portal_map(size);
+    map->generate_random_obstacles(false);
+
+    for (auto _ : state) {
+        for (int x = 0; x < size; ++x) {
+            for (int y = 0; y < size; ++y) {
+                benchmark::DoNotOptimize(map->is_valid_position({x, y}));
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * size * size);
+}
+BENCHMARK(BM_IsValidPosition)->Arg(10)->Arg(20)->Arg(40);
+
+} // namespace
@@ -0,0 +1,41 @@
+// benchmarks/bench_thread_pool.cpp
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+#include "thread_pool.hpp"
+
+namespace {
+
+constexpr int kBatch = 256;
+
+ThreadPool& shared_pool()
+{
+    static ThreadPool pool(4);
+    return pool;
+}
+
+/**
+ * 생산자 스레드 수별 enqueue → 워커 실행 처리량
+ *  - 워커 4개 고정, 생산자는 benchmark 스레드 (1/2/4/8)
+ *  - 반복마다 kBatch 개 작업을 넣고 모두 실행될 때까지 대기 (큐 경합 + 워커 깨우기 비용 포함)
+ */
+void BM_ThreadPoolThroughput(benchmark::State& state)
+{
+    auto& pool = shared_pool();
+    std::atomic<int> done{0};
+
+    for (auto _ : state) {
+        done.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < kBatch; ++i) {
+            pool.enqueue_task([&done]() { done.fetch_add(1, std::memory_order_release); });
+        }
+        while (done.load(std::memory_order_acquire) < kBatch) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kBatch);
+}
+BENCHMARK(BM_ThreadPoolThroughput)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
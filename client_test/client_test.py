@@ -16,6 +16,8 @@ class NetworkSubType:
     JOIN = 101
     LEFT = 102
     CLOSE = 103
+    PING = 104
+    PONG = 105
 
 class GameSubType:
     ROOM_CREATE = 201
@@ -26,6 +28,8 @@ class GameSubType:
     PLAYER_COME_OUT_MAP = 206
     PLAYER_FINISHED = 207
     GAME_END = 208
+    GAME_TICK = 209
+    TERRAIN_CHUNK = 212
 
 class ErrorSubType:
     UNKNOWN = 301
@@ -63,7 +67,8 @@ class ClientState:
             self.process_network(data)
         elif main_type == MainEventType.GAME:
             self.process_game(sub_type, data)
-            if sub_type == GameSubType.GAME_START or sub_type == GameSubType.PLAYER_MOVED:
+            if sub_type in (GameSubType.GAME_START, GameSubType.PLAYER_MOVED, GameSubType.GAME_TICK,
+                            GameSubType.TERRAIN_CHUNK):
                 # 게임 중에는 display_view() 호출 (단, finish 시에는 호출하지 않음)
                 if self.game_started:
                     self.display_view()
@@ -131,6 +136,10 @@ class ClientState:
             self.update_player_finished(data)
         elif sub_type == GameSubType.GAME_END:
             self.update_game_end(data)
+        elif sub_type == GameSubType.GAME_TICK:
+            self.update_snapshot(data)
+        elif sub_type == GameSubType.TERRAIN_CHUNK:
+            self.update_terrain_chunk(data)
         else:
             self.message = f"알 수 없는 GAME 서브타입: {sub_type}"
             self.refresh_screen()
@@ -213,6 +222,30 @@ class ClientState:
         if self.game_started:
             self.display_view()
 
+    def update_snapshot(self, data):
+        """틱 모드: 마지막 틱 이후 이동한 플레이어들의 위치만 반영"""
+        if data.get('map', self.current_map) != self.current_map:
+            return
+        for p in data.get('players', []):
+            pid = p.get('player_id')
+            pos = (p.get('x', 0), p.get('y', 0))
+            if pid == self.self_id:
+                self.position = pos
+            elif pid in self.players:
+                self.players[pid]['position'] = pos
+            else:
+                self.players[pid] = {'name': 'Unknown', 'position': pos}
+        self.update_seen_area(self.current_map, self.position)
+
+    def update_terrain_chunk(self, data):
+        """지형 스트리밍: 받은 청크의 장애물을 해당 맵 장애물 목록에 추가 (청크는 한 번씩만 옴)"""
+        map_info = self.maps.get(data.get('map'))
+        if map_info is None:
+            return
+        obstacles = map_info.setdefault('obstacles', [])
+        for chunk in data.get('chunks', []):
+            obstacles.extend(chunk.get('obstacles', []))
+
     def update_player_come_in_map(self, data):
         player_id = data.get('player_id', 'Unknown')
         if player_id == self.self_id:
@@ -576,7 +609,10 @@ def main():
             if r == s:
                 # 소켓에서 데이터가 들어온 경우
                 packet = parse_packet(s)
-                if packet is not None:
+                if packet is not None and packet[0] == MainEventType.NETWORK and packet[1] == NetworkSubType.PING:
+                    # 하트비트: 받은 seq 를 그대로 PONG 으로 응답
+                    s.sendall(build_packet(MainEventType.NETWORK, NetworkSubType.PONG, packet[2]))
+                elif packet is not None:
                     state.process_packet(packet)
                 else:
                     print("서버와의 연결이 끊어졌습니다.")
@@ -0,0 +1,581 @@
+#include "event.hpp"
+#include "metrics.hpp"
+#include <boost/asio.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <queue>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * load_generator
+ *  - 실제 프로토콜로 말하는 봇 클라이언트 N개를 asio 로 띄워 서버 부하를 만든다
+ *  - 봇: 접속 → JOIN → ROOM_CREATE 의 맵(장애물) 저장 → GAME_START 후 BFS 경로(포탈 / 도착점)를
+ *        move_hz 속도로 한 칸씩 PLAYER_MOVED(seq 포함) 전송 → GAME_END 후 다시 JOIN
+ *  - 지연: 이동 전송 → 그 seq 의 ack 수신 (즉시 모드 move_ack / 틱·시뮬레이션 모드 스냅샷의 본인 seq)
+ *    (ack 는 같은 맵 브로드캐스트와 같은 핸들러 처리에서 보내지므로 이동 → 브로드캐스트 지연으로 사용)
+ *  - 1초마다 처리량, 종료 시 지연 백분위수 출력
+ *
+ * 사용법: load_generator [--host 127.0.0.1] [--port 12345] [--bots 1000] [--threads 4]
+ *                        [--connect-rate 500] [--move-hz 5] [--duration 60]
+ */
+
+using boost::asio::ip::tcp;
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    std::string host = "127.0.0.1";
+    unsigned short port = 12345;
+    int bots = 1000;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int connect_rate = 500;   // 초당 새 접속 수
+    double move_hz = 5;       // 봇당 초당 이동 수
+    int duration_s = 60;      // 측정 시간 (초)
+};
+
+// 전체 봇 공용 통계 (여러 io 스레드에서 갱신)
+struct Stats {
+    std::atomic<uint64_t> connected{0};
+    std::atomic<uint64_t> disconnected{0};
+    std::atomic<uint64_t> joins{0};
+    std::atomic<uint64_t> rooms{0};        // 받은 ROOM_CREATE 수 (봇 기준)
+    std::atomic<uint64_t> games_ended{0};  // 받은 GAME_END 수 (봇 기준)
+    std::atomic<uint64_t> finished{0};     // 도착한 봇 수
+    std::atomic<uint64_t> moves_sent{0};
+    std::atomic<uint64_t> moves_acked{0};
+    std::atomic<uint64_t> moves_rejected{0};
+    std::atomic<uint64_t> frames_in{0};
+    std::atomic<uint64_t> bytes_in{0};
+    std::atomic<uint64_t> bytes_out{0};
+    Histogram move_latency_us;
+};
+
+Stats g_stats;
+
+int64_t now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// 서버와 같은 프레이밍: 8바이트 헤더 + 8바이트 배수로 패딩한 본문
+std::string make_frame(MainEventType main_type, uint16_t sub_type, const std::string& body)
+{
+    std::string frame(8, '\0');
+    uint16_t main_value = static_cast<uint16_t>(main_type);
+    uint32_t length = static_cast<uint32_t>(body.size());
+    std::memcpy(&frame[0], &main_value, 2);
+    std::memcpy(&frame[2], &sub_type, 2);
+    std::memcpy(&frame[4], &length, 4);
+    frame += body;
+    frame.resize(8 + (body.size() + 7) / 8 * 8, '\0');
+    return frame;
+}
+
+// 봇이 아는 맵 정보 (ROOM_CREATE / TERRAIN_CHUNK)
+struct MapInfo {
+    int width = 0;
+    int height = 0;
+    std::pair<int, int> start;
+    std::pair<int, int> goal;       // 포탈 또는 도착점
+    bool end_map = false;
+    std::set<std::pair<int, int>> obstacles;
+};
+
+/**
+ * 시작 → 목표 최단 경로 (상하좌우, 테두리/장애물 제외), 시작 칸은 포함하지 않음
+ * - 지형 스트리밍으로 아직 모르는 장애물은 빈 칸으로 가정 (거절되면 보정 위치에서 다시 계산)
+ */
+std::vector<std::pair<int, int>> bfs(const MapInfo& map, std::pair<int, int> from)
+{
+    std::map<std::pair<int, int>, std::pair<int, int>> prev;
+    std::queue<std::pair<int, int>> q;
+    prev[from] = from;
+    q.push(from);
+    while (!q.empty()) {
+        auto cur = q.front();
+        q.pop();
+        if (cur == map.goal) {
+            break;
+        }
+        static constexpr int dx[] = {1, -1, 0, 0};
+        static constexpr int dy[] = {0, 0, 1, -1};
+        for (int d = 0; d < 4; ++d) {
+            std::pair<int, int> next{cur.first + dx[d], cur.second + dy[d]};
+            if (next.first <= 0 || next.second <= 0 || next.first >= map.width - 1 || next.second >= map.height - 1) {
+                continue;
+            }
+            if (map.obstacles.count(next) || prev.count(next)) {
+                continue;
+            }
+            prev[next] = cur;
+            q.push(next);
+        }
+    }
+
+    std::vector<std::pair<int, int>> path;
+    if (!prev.count(map.goal)) {
+        return path;
+    }
+    for (auto cur = map.goal; cur != from; cur = prev[cur]) {
+        path.push_back(cur);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+/**
+ * Bot: 커넥션 1개 = 플레이어 1명
+ * - 봇마다 하나의 io_context 에서만 실행 → 내부 상태 잠금 없음
+ */
+class Bot : public std::enable_shared_from_this<Bot> {
+public:
+    Bot(boost::asio::io_context& ioc, const Options& options, int index)
+        : socket_(ioc)
+        , move_timer_(ioc)
+        , options_(options)
+        , name_("bot" + std::to_string(index))
+    {
+    }
+
+    void start(const tcp::resolver::results_type& endpoints) {
+        auto self = shared_from_this();
+        boost::asio::async_connect(socket_, endpoints,
+            [this, self](const boost::system::error_code& ec, const tcp::endpoint&) {
+                if (ec) {
+                    g_stats.disconnected++;
+                    return;
+                }
+                g_stats.connected++;
+                socket_.set_option(tcp::no_delay(true));
+                join();
+                read_header();
+            });
+    }
+
+    void stop() {
+        boost::system::error_code ignored;
+        move_timer_.cancel();
+        socket_.close(ignored);
+    }
+
+private:
+    void join() {
+        in_game_ = false;
+        send(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::JOIN), json{{"player_name", name_}}.dump());
+        g_stats.joins++;
+    }
+
+    void send(MainEventType main_type, uint16_t sub_type, const std::string& body) {
+        write_queue_.push_back(make_frame(main_type, sub_type, body));
+        if (write_queue_.size() == 1) {
+            do_write();
+        }
+    }
+
+    void do_write() {
+        auto self = shared_from_this();
+        boost::asio::async_write(socket_, boost::asio::buffer(write_queue_.front()),
+            [this, self](const boost::system::error_code& ec, std::size_t bytes) {
+                if (ec) {
+                    return; // 읽기 쪽에서 종료 처리
+                }
+                g_stats.bytes_out += bytes;
+                write_queue_.pop_front();
+                if (!write_queue_.empty()) {
+                    do_write();
+                }
+            });
+    }
+
+    void read_header() {
+        auto self = shared_from_this();
+        boost::asio::async_read(socket_, boost::asio::buffer(header_),
+            [this, self](const boost::system::error_code& ec, std::size_t) {
+                if (ec) {
+                    on_disconnect();
+                    return;
+                }
+                uint32_t length = 0;
+                std::memcpy(&main_type_, &header_[0], 2);
+                std::memcpy(&sub_type_, &header_[2], 2);
+                std::memcpy(&length, &header_[4], 4);
+                body_length_ = length;
+                body_.resize((length + 7) / 8 * 8);
+                if (body_.empty()) {
+                    on_frame();
+                    read_header();
+                    return;
+                }
+                read_body();
+            });
+    }
+
+    void read_body() {
+        auto self = shared_from_this();
+        boost::asio::async_read(socket_, boost::asio::buffer(body_),
+            [this, self](const boost::system::error_code& ec, std::size_t) {
+                if (ec) {
+                    on_disconnect();
+                    return;
+                }
+                on_frame();
+                read_header();
+            });
+    }
+
+    void on_disconnect() {
+        if (!closed_) {
+            closed_ = true;
+            g_stats.disconnected++;
+            move_timer_.cancel();
+        }
+    }
+
+    void on_frame() {
+        g_stats.frames_in++;
+        g_stats.bytes_in += 8 + body_.size();
+
+        json msg;
+        try {
+            msg = json::parse(body_.begin(), body_.begin() + body_length_);
+        } catch (const std::exception&) {
+            return;
+        }
+
+        switch (main_type_) {
+        case static_cast<uint16_t>(MainEventType::NETWORK):
+            if (sub_type_ == static_cast<uint16_t>(NetworkSubType::JOIN)) {
+                player_id_ = msg.value("player_id", "");
+            } else if (sub_type_ == static_cast<uint16_t>(NetworkSubType::PING)) {
+                send(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::PONG), msg.dump());
+            }
+            break;
+        case static_cast<uint16_t>(MainEventType::GAME):
+            on_game_frame(msg);
+            break;
+        case static_cast<uint16_t>(MainEventType::ERROR):
+            on_rejected(msg);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void on_game_frame(const json& msg) {
+        switch (static_cast<GameSubType>(sub_type_)) {
+        case GameSubType::ROOM_CREATE:
+            load_maps(msg);
+            g_stats.rooms++;
+            break;
+        case GameSubType::GAME_START:
+            in_game_ = true;
+            plan();
+            schedule_move();
+            break;
+        case GameSubType::PLAYER_MOVED:
+            if (msg.value("action", "") == "move_ack") {
+                on_ack(msg.value("seq", 0u));
+            }
+            break;
+        case GameSubType::GAME_TICK:
+            for (const auto& p : msg.value("players", json::array())) {
+                if (p.value("player_id", "") == player_id_ && p.contains("seq")) {
+                    on_ack(p["seq"].get<uint32_t>());
+                }
+            }
+            break;
+        case GameSubType::PLAYER_COME_IN_MAP:
+            if (msg.value("player_id", "") == player_id_) {
+                map_name_ = msg.value("map", map_name_);
+                pos_ = {msg.value("x", 0), msg.value("y", 0)};
+                plan();
+            }
+            break;
+        case GameSubType::PLAYER_FINISHED:
+            if (msg.value("player_id", "") == player_id_) {
+                g_stats.finished++;
+                path_.clear();
+            }
+            break;
+        case GameSubType::TERRAIN_CHUNK: {
+            auto it = maps_.find(msg.value("map", ""));
+            if (it == maps_.end()) break;
+            for (const auto& chunk : msg.value("chunks", json::array())) {
+                for (const auto& o : chunk.value("obstacles", json::array())) {
+                    it->second.obstacles.insert({o["x"].get<int>(), o["y"].get<int>()});
+                }
+            }
+            if (it->first == map_name_ && in_game_) {
+                plan();
+            }
+            break;
+        }
+        case GameSubType::GAME_END:
+            g_stats.games_ended++;
+            move_timer_.cancel();
+            path_.clear();
+            join(); // 다음 게임
+            break;
+        default:
+            break;
+        }
+    }
+
+    // 거절: 서버가 보낸 보정 위치에서 다시 계산
+    void on_rejected(const json& msg) {
+        if (msg.value("action", "") != "player_moved") {
+            return;
+        }
+        g_stats.moves_rejected++;
+        map_name_ = msg.value("map", map_name_);
+        pos_ = {msg.value("x", pos_.first), msg.value("y", pos_.second)};
+        if (msg.contains("rejected_seq")) {
+            // 거절된 이후 입력은 ack 가 오지 않음
+            acked_seq_ = std::max(acked_seq_, next_seq_ - 1);
+        }
+        plan();
+    }
+
+    void on_ack(uint32_t seq) {
+        int64_t now = now_us();
+        for (uint32_t s = acked_seq_ + 1; s <= seq && s < next_seq_; ++s) {
+            g_stats.move_latency_us.record(static_cast<uint64_t>(now - sent_at_[s % sent_at_.size()]));
+            g_stats.moves_acked++;
+        }
+        acked_seq_ = std::max(acked_seq_, seq);
+    }
+
+    void load_maps(const json& msg) {
+        maps_.clear();
+        for (const auto& m : msg.value("maps", json::array())) {
+            MapInfo info;
+            info.width = m.value("width", 0);
+            info.height = m.value("height", 0);
+            info.start = {m["start"]["x"].get<int>(), m["start"]["y"].get<int>()};
+            auto portals = m.value("portals", json::array());
+            if (!portals.empty()) {
+                info.goal = {portals[0]["x"].get<int>(), portals[0]["y"].get<int>()};
+            } else {
+                info.end_map = true;
+                info.goal = {m["end"]["x"].get<int>(), m["end"]["y"].get<int>()};
+            }
+            for (const auto& o : m.value("obstacles", json::array())) {
+                info.obstacles.insert({o["x"].get<int>(), o["y"].get<int>()});
+            }
+            maps_[m.value("name", "")] = std::move(info);
+        }
+        // 시작 맵: 첫 번째 맵 (서버가 maps_[0] 에 배정)
+        if (!msg.value("maps", json::array()).empty()) {
+            map_name_ = msg["maps"][0].value("name", "");
+            pos_ = maps_[map_name_].start;
+        }
+    }
+
+    void plan() {
+        auto it = maps_.find(map_name_);
+        path_.clear();
+        next_step_ = 0;
+        if (it != maps_.end()) {
+            path_ = bfs(it->second, pos_);
+        }
+    }
+
+    void schedule_move() {
+        auto self = shared_from_this();
+        move_timer_.expires_after(std::chrono::microseconds(static_cast<int64_t>(1e6 / options_.move_hz)));
+        move_timer_.async_wait([this, self](const boost::system::error_code& ec) {
+            if (ec || closed_ || !in_game_) {
+                return;
+            }
+            if (next_step_ < path_.size()) {
+                auto step = path_[next_step_++];
+                uint32_t seq = next_seq_++;
+                sent_at_[seq % sent_at_.size()] = now_us();
+                send(MainEventType::GAME, static_cast<uint16_t>(GameSubType::PLAYER_MOVED),
+                     json{{"x", step.first}, {"y", step.second}, {"seq", seq}}.dump());
+                pos_ = step; // 클라이언트 측 예측
+                g_stats.moves_sent++;
+            }
+            schedule_move();
+        });
+    }
+
+    tcp::socket socket_;
+    boost::asio::steady_timer move_timer_;
+    const Options& options_;
+    const std::string name_;
+    bool closed_ = false;
+
+    std::deque<std::string> write_queue_;
+    std::array<char, 8> header_{};
+    uint16_t main_type_ = 0;
+    uint16_t sub_type_ = 0;
+    std::size_t body_length_ = 0;
+    std::vector<char> body_;
+
+    // 게임 상태
+    std::string player_id_;
+    bool in_game_ = false;
+    std::map<std::string, MapInfo> maps_;
+    std::string map_name_;
+    std::pair<int, int> pos_;
+    std::vector<std::pair<int, int>> path_;
+    std::size_t next_step_ = 0;
+
+    // 지연 측정: seq → 전송 시각 (최근 1024개)
+    uint32_t next_seq_ = 1;
+    uint32_t acked_seq_ = 0;
+    std::array<int64_t, 1024> sent_at_{};
+};
+
+bool parse_options(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string key = argv[i];
+        if (key == "--help" || i + 1 >= argc) {
+            return false;
+        }
+        std::string value = argv[++i];
+        try {
+            if (key == "--host") options.host = value;
+            else if (key == "--port") options.port = static_cast<unsigned short>(std::stoi(value));
+            else if (key == "--bots") options.bots = std::stoi(value);
+            else if (key == "--threads") options.threads = std::max(1, std::stoi(value));
+            else if (key == "--connect-rate") options.connect_rate = std::max(1, std::stoi(value));
+            else if (key == "--move-hz") options.move_hz = std::max(0.1, std::stod(value));
+            else if (key == "--duration") options.duration_s = std::stoi(value);
+            else return false;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 1초 간격 처리량 (이전 값과의 차이)
+struct RateSnapshot {
+    uint64_t moves_sent = 0;
+    uint64_t moves_acked = 0;
+    uint64_t frames_in = 0;
+    uint64_t bytes_in = 0;
+};
+
+RateSnapshot take_snapshot()
+{
+    return {g_stats.moves_sent.load(), g_stats.moves_acked.load(), g_stats.frames_in.load(), g_stats.bytes_in.load()};
+}
+
+void print_summary(double elapsed_s)
+{
+    const auto& h = g_stats.move_latency_us;
+    std::cout << "\n=== load_generator summary (" << elapsed_s << " s) ===\n"
+              << "connected=" << g_stats.connected << " disconnected=" << g_stats.disconnected
+              << " joins=" << g_stats.joins << " rooms=" << g_stats.rooms
+              << " games_ended=" << g_stats.games_ended << " finished=" << g_stats.finished << "\n"
+              << "moves sent=" << g_stats.moves_sent << " acked=" << g_stats.moves_acked
+              << " rejected=" << g_stats.moves_rejected
+              << " (" << g_stats.moves_sent / elapsed_s << " moves/s)\n"
+              << "frames in=" << g_stats.frames_in << " (" << g_stats.frames_in / elapsed_s << "/s)"
+              << " bytes in=" << g_stats.bytes_in << " out=" << g_stats.bytes_out << "\n"
+              << "move->ack latency us: p50=" << h.value_at_quantile(0.50)
+              << " p90=" << h.value_at_quantile(0.90)
+              << " p99=" << h.value_at_quantile(0.99)
+              << " p99.9=" << h.value_at_quantile(0.999)
+              << " max=" << h.value_at_quantile(1.0)
+              << " (n=" << h.count() << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "usage: load_generator [--host H] [--port P] [--bots N] [--threads T]\n"
+                  << "                      [--connect-rate R] [--move-hz HZ] [--duration S]" << std::endl;
+        return 1;
+    }
+
+    // io 스레드마다 io_context 1개 (봇은 하나에만 속함)
+    std::vector<std::unique_ptr<boost::asio::io_context>> contexts;
+    std::vector<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> guards;
+    for (int i = 0; i < options.threads; ++i) {
+        contexts.push_back(std::make_unique<boost::asio::io_context>(1));
+        guards.push_back(boost::asio::make_work_guard(*contexts.back()));
+    }
+
+    tcp::resolver resolver(*contexts[0]);
+    auto endpoints = resolver.resolve(options.host, std::to_string(options.port));
+
+    std::vector<std::thread> threads;
+    for (auto& ctx : contexts) {
+        threads.emplace_back([&ctx]() { ctx->run(); });
+    }
+
+    std::cout << "load_generator: " << options.bots << " bots -> " << options.host << ":" << options.port
+              << ", " << options.threads << " threads, " << options.move_hz << " moves/s per bot, "
+              << options.duration_s << " s" << std::endl;
+
+    // 접속 속도 제한: connect_rate 개/초 씩 나눠서 시작
+    std::vector<std::shared_ptr<Bot>> bots;
+    bots.reserve(options.bots);
+    const auto start = Clock::now();
+    const auto deadline = start + std::chrono::seconds(options.duration_s);
+    auto next_report = start + std::chrono::seconds(1);
+    RateSnapshot last = take_snapshot();
+
+    while (Clock::now() < deadline) {
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        int target = std::min(options.bots, static_cast<int>(elapsed * options.connect_rate) + 1);
+        while (static_cast<int>(bots.size()) < target) {
+            int index = static_cast<int>(bots.size());
+            auto& ctx = *contexts[index % contexts.size()];
+            auto bot = std::make_shared<Bot>(ctx, options, index);
+            boost::asio::post(ctx, [bot, endpoints]() { bot->start(endpoints); });
+            bots.push_back(std::move(bot));
+        }
+
+        if (Clock::now() >= next_report) {
+            RateSnapshot now = take_snapshot();
+            std::cout << "[" << static_cast<int>(elapsed) << "s] bots=" << bots.size()
+                      << " connected=" << g_stats.connected - g_stats.disconnected
+                      << " moves/s=" << now.moves_sent - last.moves_sent
+                      << " acks/s=" << now.moves_acked - last.moves_acked
+                      << " frames_in/s=" << now.frames_in - last.frames_in
+                      << " KB_in/s=" << (now.bytes_in - last.bytes_in) / 1024
+                      << " p99_us=" << g_stats.move_latency_us.value_at_quantile(0.99) << std::endl;
+            last = now;
+            next_report += std::chrono::seconds(1);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    print_summary(elapsed);
+
+    for (std::size_t i = 0; i < bots.size(); ++i) {
+        auto bot = bots[i];
+        boost::asio::post(*contexts[i % contexts.size()], [bot]() { bot->stop(); });
+    }
+    guards.clear();
+    for (auto& ctx : contexts) {
+        ctx->stop();
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    return 0;
+}
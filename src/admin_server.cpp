@@ -0,0 +1,331 @@
+#include "admin_server.hpp"
+#include "connection.hpp"
+#include "connection_manager.hpp"
+#include "metrics.hpp"
+#include "tracer.hpp"
+#include "profiled_mutex.hpp"
+#include "cpu_profiler.hpp"
+#include "room.hpp"
+#include "timer_service.hpp"
+#include "logger.hpp"
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <sstream>
+
+using boost::asio::ip::tcp;
+
+namespace {
+
+// 쿼리 문자열의 정수 값 (예: /profile/start?seconds=30), 없거나 잘못되면 fallback
+int query_int(const std::string& path, const std::string& key, int fallback)
+{
+    auto q = path.find('?');
+    if (q == std::string::npos) {
+        return fallback;
+    }
+    std::istringstream params(path.substr(q + 1));
+    std::string pair;
+    while (std::getline(params, pair, '&')) {
+        auto eq = pair.find('=');
+        if (eq != std::string::npos && pair.compare(0, eq, key) == 0) {
+            try {
+                return std::stoi(pair.substr(eq + 1));
+            } catch (const std::exception&) {
+                return fallback;
+            }
+        }
+    }
+    return fallback;
+}
+
+// 상태를 바꾸는 경로 (POST 전용)
+bool is_control_path(const std::string& path)
+{
+    return path == "/trace/start" || path == "/trace/stop"
+        || path == "/locks/start" || path == "/locks/stop"
+        || path == "/profile/start" || path.rfind("/profile/start?", 0) == 0
+        || path == "/profile/stop";
+}
+
+const char* reason_phrase(int status)
+{
+    switch (status) {
+    case 200: return "OK";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 409: return "Conflict";
+    default:  return "Error";
+    }
+}
+
+// CPU 프로파일 상태
+std::string profile_json()
+{
+    auto s = CpuProfiler::get_instance().status();
+    return nlohmann::json{
+        {"running", s.running},
+        {"file", s.path},
+        {"hz", s.hz},
+        {"samples", s.samples},
+        {"dropped", s.dropped},
+        {"written", s.written}
+    }.dump(2);
+}
+
+// 방 자원 사용량: 최근 구간 / 누적 (CPU ms, 수신 입력, 송신 메시지/바이트), 제한 상태
+nlohmann::json usage_json(const Room& room)
+{
+    auto to_json = [](const RoomUsage::Totals& t) {
+        return nlohmann::json{
+            {"cpu_ms", t.cpu_us / 1000.0},
+            {"msgs_in", t.msgs_in},
+            {"bytes_in", t.bytes_in},
+            {"msgs_out", t.msgs_out},
+            {"bytes_out", t.bytes_out}
+        };
+    };
+    return {
+        {"window_ms", room.usage().budget().window_ms},
+        {"window", to_json(room.usage().window_totals())},
+        {"total", to_json(room.usage().lifetime_totals())},
+        {"throttled", room.usage().throttled()},
+        {"throttled_inputs", room.usage().throttled_inputs()}
+    };
+}
+
+} // namespace
+
+/**
+ * 요청 1건 처리 세션
+ * - 헤더 끝(\r\n\r\n)까지 읽고 요청 줄(METHOD /path HTTP/1.x)만 사용 (POST 본문은 무시)
+ * - 응답 후 연결 종료 (HTTP/1.0 방식)
+ */
+class AdminServer::Session : public std::enable_shared_from_this<Session> {
+public:
+    Session(tcp::socket socket, const AdminServer& server)
+        : socket_(std::move(socket))
+        , server_(server)
+        , request_(8 * 1024) // 요청 최대 크기
+    {
+    }
+
+    void start() {
+        auto self = shared_from_this();
+        boost::asio::async_read_until(socket_, request_, "\r\n\r\n",
+            [this, self](const boost::system::error_code& ec, std::size_t) {
+                if (ec) {
+                    return;
+                }
+                std::istream is(&request_);
+                std::string method, path;
+                is >> method >> path;
+
+                write(server_.build_response(path, method));
+            });
+    }
+
+private:
+    void write(const Response& res) {
+        std::ostringstream out;
+        out << "HTTP/1.0 " << res.status << " " << reason_phrase(res.status) << "\r\n"
+            << "Content-Type: " << res.content_type << "\r\n"
+            << "Content-Length: " << res.body.size() << "\r\n";
+        if (!res.allow.empty()) {
+            out << "Allow: " << res.allow << "\r\n";
+        }
+        out << "Connection: close\r\n\r\n"
+            << res.body;
+        response_ = out.str();
+
+        auto self = shared_from_this();
+        boost::asio::async_write(socket_, boost::asio::buffer(response_),
+            [this, self](const boost::system::error_code&, std::size_t) {
+                boost::system::error_code ignored;
+                socket_.shutdown(tcp::socket::shutdown_both, ignored);
+                socket_.close(ignored);
+            });
+    }
+
+    tcp::socket socket_;
+    const AdminServer& server_;
+    boost::asio::streambuf request_;
+    std::string response_;
+};
+
+AdminServer::AdminServer(const ServerConfig& config, GameManager& gm, ThreadPool& thread_pool)
+    : config_(config)
+    , game_manager_(gm)
+    , thread_pool_(thread_pool)
+{
+}
+
+AdminServer::~AdminServer()
+{
+    stop();
+}
+
+void AdminServer::start(unsigned short port)
+{
+    if (acceptor_) {
+        return;
+    }
+    acceptor_ = std::make_unique<tcp::acceptor>(
+        ioc_, tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), port));
+    start_accept();
+    thread_ = std::thread([this]() { ioc_.run(); });
+    LOG_INFO("[AdminServer] listening on 127.0.0.1:" << port);
+}
+
+void AdminServer::stop()
+{
+    ioc_.stop();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void AdminServer::start_accept()
+{
+    acceptor_->async_accept([this](const boost::system::error_code& ec, tcp::socket socket) {
+        if (!ec) {
+            std::make_shared<Session>(std::move(socket), *this)->start();
+        }
+        start_accept();
+    });
+}
+
+AdminServer::Response AdminServer::build_response(const std::string& path, const std::string& method) const
+{
+    Response res;
+    const std::string allowed = is_control_path(path) ? "POST" : "GET";
+    if (method != allowed) {
+        res.status = 405;
+        res.content_type = "text/plain";
+        res.body = "method not allowed\n";
+        res.allow = allowed;
+        return res;
+    }
+
+    if (path == "/metrics") {
+        res.content_type = "text/plain; version=0.0.4";
+        res.body = MetricsRegistry::get_instance().render_prometheus();
+    } else if (path == "/rooms") {
+        res.body = rooms_json();
+    } else if (path == "/connections") {
+        res.body = connections_json();
+    } else if (path == "/threads") {
+        res.body = threads_json();
+    } else if (path == "/trace") {
+        res.body = Tracer::get_instance().dump_chrome_json();
+    } else if (path == "/trace/start") {
+        Tracer::get_instance().clear();
+        Tracer::get_instance().set_enabled(true);
+        res.body = "{\"tracing\": true}";
+    } else if (path == "/trace/stop") {
+        Tracer::get_instance().set_enabled(false);
+        res.body = "{\"tracing\": false}";
+    } else if (path == "/locks") {
+        res.body = ProfiledMutex::report_json();
+    } else if (path == "/locks/start") {
+        ProfiledMutex::set_enabled(true);
+        res.body = "{\"profiling\": true}";
+    } else if (path == "/locks/stop") {
+        ProfiledMutex::set_enabled(false);
+        res.body = "{\"profiling\": false}";
+    } else if (path == "/profile") {
+        res.body = profile_json();
+    } else if (path == "/profile/start" || path.rfind("/profile/start?", 0) == 0) {
+        int seconds = query_int(path, "seconds", config_.cpu_profile_seconds);
+        if (!CpuProfiler::get_instance().start(config_.cpu_profile_file, seconds * 1000, config_.cpu_profile_hz)) {
+            res.status = 409;
+        }
+        res.body = profile_json();
+    } else if (path == "/profile/stop") {
+        CpuProfiler::get_instance().stop();
+        res.body = profile_json();
+    } else if (path == "/config") {
+        res.body = config_.to_json().dump(2);
+    } else if (path == "/") {
+        res.body = nlohmann::json{{"endpoints", {"GET /metrics", "GET /rooms", "GET /connections", "GET /threads", "GET /config",
+                                                "GET /trace", "POST /trace/start", "POST /trace/stop",
+                                                "GET /locks", "POST /locks/start", "POST /locks/stop",
+                                                "GET /profile", "POST /profile/start?seconds=N", "POST /profile/stop"}}}.dump(2);
+    } else {
+        res.status = 404;
+        res.content_type = "text/plain";
+        res.body = "not found\n";
+    }
+    return res;
+}
+
+// 방 목록: [{ "id", "age_ms", "players", "present", "ending", "mode", "maps": {"A": 2, ...}, "usage" }]
+std::string AdminServer::rooms_json() const
+{
+    const auto now = std::chrono::steady_clock::now();
+    nlohmann::json rooms = nlohmann::json::array();
+    for (const auto& room : game_manager_.get_all_rooms()) {
+        nlohmann::json maps = nlohmann::json::object();
+        for (const auto& map : room->get_maps()) {
+            maps[map->name] = map->get_players_snapshot()->size();
+        }
+        rooms.push_back({
+            {"id", room->id_},
+            {"age_ms", std::chrono::duration_cast<std::chrono::milliseconds>(now - room->created_at_).count()},
+            {"players", room->get_all_players().size()},
+            {"present", room->present_count()},
+            {"all_finished", room->is_all_players_finished()},
+            {"ending", room->is_ending()},
+            {"mode", room->is_simulation_mode() ? "simulation" : (room->is_tick_mode() ? "tick" : "immediate")},
+            {"maps", maps},
+            {"usage", usage_json(*room)}
+        });
+    }
+    return nlohmann::json{{"count", rooms.size()}, {"waiting", game_manager_.waiting_count()}, {"rooms", rooms}}.dump(2);
+}
+
+// 커넥션 목록: [{ "handle", "player_id", "room_id", "pending_writes", "idle_ms", "rtt": {...} }]
+std::string AdminServer::connections_json() const
+{
+    auto& cm = ConnectionManager::get_instance();
+    nlohmann::json conns = nlohmann::json::array();
+    for (const auto& conn : cm.get_all_connections()) {
+        auto player = conn->get_player();
+        auto rtt = conn->rtt();
+        nlohmann::json entry {
+            {"pending_writes", conn->pending_write_count()},
+            {"idle_ms", conn->idle_ms()},
+            {"rtt", {
+                {"samples", rtt.sample_count()},
+                {"srtt_ms", rtt.srtt_ms()},
+                {"rttvar_ms", rtt.rttvar_ms()},
+                {"last_ms", rtt.last_ms()}
+            }}
+        };
+        if (player) {
+            entry["player_id"] = player->id_;
+            entry["room_id"] = player->room_id();
+        }
+        conns.push_back(std::move(entry));
+    }
+    return nlohmann::json{{"count", conns.size()}, {"connections", conns}}.dump(2);
+}
+
+// 스레드풀 / 큐 / 타이머 상태
+std::string AdminServer::threads_json() const
+{
+    auto& reg = MetricsRegistry::get_instance();
+    auto& pool_wait = reg.histogram("asio_server_thread_pool_queue_wait_us", "Time a task waits in the pool queue");
+    return nlohmann::json{
+        {"thread_pool", {
+            {"workers", thread_pool_.worker_count()},
+            {"queued_tasks", thread_pool_.queued_task_count()},
+            {"queue_wait_us", {
+                {"p50", pool_wait.value_at_quantile(0.5)},
+                {"p99", pool_wait.value_at_quantile(0.99)},
+                {"max", pool_wait.value_at_quantile(1.0)}
+            }}
+        }},
+        {"reactor_queue_depth", reg.gauge("asio_server_reactor_queue_depth", "Events waiting in the reactor queue").value()},
+        {"pending_timers", TimerService::get_instance().pending_count()}
+    }.dump(2);
+}
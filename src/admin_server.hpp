@@ -0,0 +1,64 @@
+#ifndef ADMIN_SERVER_HPP
+#define ADMIN_SERVER_HPP
+
+#include <boost/asio.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include "game_manager.hpp"
+#include "thread_pool.hpp"
+#include "server_config.hpp"
+
+/**
+ * AdminServer
+ *  - 운영/진단용 HTTP 엔드포인트 (127.0.0.1 전용, 요청 1건 처리 후 연결 종료)
+ *  - 게임 io_context 와 분리된 자체 io_context + 스레드 1개 → 조회가 게임 트래픽과 경쟁하지 않음
+ *  - GET /metrics      : 지표 스냅샷 (Prometheus 텍스트)
+ *  - GET /rooms        : 방 목록 (인원, 경과 시간, 맵별 인원, 모드)
+ *  - GET /connections  : 커넥션 목록 (송신 대기 수, 유휴 시간, RTT)
+ *  - GET /threads      : 스레드풀 / 리액터 큐 / 타이머 상태
+ *  - GET /config       : 현재 서버 설정
+ *  - GET /trace        : 요청 추적 구간 (Chrome trace JSON), POST /trace/start, /trace/stop 으로 전환
+ *  - GET /locks        : 뮤텍스 경합 요약, POST /locks/start, /locks/stop 으로 전환
+ *  - GET /profile      : CPU 프로파일 상태, POST /profile/start?seconds=N 으로 시작, POST /profile/stop 으로 즉시 기록
+ *  - 상태를 바꾸는 경로는 POST 만, 조회 경로는 GET 만 허용 (그 외 405 + Allow)
+ *    → 브라우저 / 링크 미리보기 / 크롤러의 GET 으로 추적·프로파일이 켜지지 않도록
+ */
+class AdminServer {
+public:
+    struct Response {
+        int status = 200;
+        std::string content_type = "application/json";
+        std::string body;
+        std::string allow;  // 405 일 때 허용 메서드 (Allow 헤더)
+    };
+
+    AdminServer(const ServerConfig& config, GameManager& gm, ThreadPool& thread_pool);
+    ~AdminServer();
+
+    // port 로 리슨 시작 (별도 스레드)
+    void start(unsigned short port);
+    void stop();
+
+    // 메서드 / 경로별 응답 생성 (리슨 없이도 호출 가능)
+    Response build_response(const std::string& path, const std::string& method = "GET") const;
+
+private:
+    class Session;
+
+    void start_accept();
+
+    std::string rooms_json() const;
+    std::string connections_json() const;
+    std::string threads_json() const;
+
+    const ServerConfig& config_;
+    GameManager& game_manager_;
+    ThreadPool& thread_pool_;
+
+    boost::asio::io_context ioc_;
+    std::unique_ptr<boost::asio::ip::tcp::acceptor> acceptor_;
+    std::thread thread_;
+};
+
+#endif // ADMIN_SERVER_HPP
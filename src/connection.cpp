@@ -1,12 +1,38 @@
 #include "connection.hpp"
 #include "reactor.hpp"
+#include "logger.hpp"
+#include "metrics.hpp"
+#include "tracer.hpp"
+#include "probes.hpp"
 #include <boost/asio.hpp>
-#include <iostream>
 
 #define PER_BYTE 8
 
+namespace {
+
+struct TrafficMetrics {
+    Counter& frames_in;
+    Counter& bytes_in;
+    Counter& frames_out;
+    Counter& bytes_out;
+};
+
+TrafficMetrics& traffic_metrics()
+{
+    static TrafficMetrics m {
+        MetricsRegistry::get_instance().counter("asio_server_frames_in_total", "Frames received from clients"),
+        MetricsRegistry::get_instance().counter("asio_server_bytes_in_total", "Bytes received from clients (header + padded body)"),
+        MetricsRegistry::get_instance().counter("asio_server_frames_out_total", "Frames written to clients"),
+        MetricsRegistry::get_instance().counter("asio_server_bytes_out_total", "Bytes written to clients"),
+    };
+    return m;
+}
+
+} // namespace
+
 Connection::Connection(tcp::socket socket)
     : socket_(std::move(socket))
+    , last_recv_ms_(now_ms())
 {
 }
 
@@ -28,6 +54,7 @@ void Connection::read_chunk() {
         [this, self, chunk_buffer](const boost::system::error_code& ec, std::size_t bytes_transferred)
         {
             if (!ec && bytes_transferred == PER_BYTE) {
+                touch();
                 // 헤더인지 판별
                 try {
                     if (is_header(*chunk_buffer)) {
@@ -149,7 +176,12 @@ void Connection::read_body_chunk(std::shared_ptr<std::vector<char>> body_buffer,
                     read_body_chunk(body_buffer, header, total);
                 } else {
                     // 완전히 읽음
-                    std::cout << "[Connection] Received packet: main_type={" << (int)header.main_type << "}, sub_type={" << (int)header.sub_type << "}, body_len={" << (int)header.body_length << "}\n";
+                    LOG_DEBUG("[Connection] Received packet: main_type={" << (int)header.main_type << "}, sub_type={" << (int)header.sub_type << "}, body_len={" << (int)header.body_length << "}");
+                    traffic_metrics().frames_in.inc();
+                    traffic_metrics().bytes_in.inc(PER_BYTE + body_buffer->size());
+                    SERVER_PROBE4(frame_received, PROBE_CONN_ID(this), static_cast<int>(header.main_type),
+                                  header.sub_type, header.body_length);
+
                     // 패딩 제거
                     std::vector<char> actual_data(
                         body_buffer->begin(),
@@ -162,6 +194,10 @@ void Connection::read_body_chunk(std::shared_ptr<std::vector<char>> body_buffer,
                     ev.sub_type  = header.sub_type;
                     ev.connection= self;
                     ev.data      = std::move(actual_data);
+                    if (Tracer::get_instance().enabled()) {
+                        ev.trace_id = Tracer::get_instance().next_trace_id();
+                        TRACE_INSTANT("frame_read", ev.trace_id);
+                    }
 
                     Reactor::get_instance().enqueue_event(ev);
 
@@ -189,20 +225,102 @@ void Connection::read_body_chunk(std::shared_ptr<std::vector<char>> body_buffer,
     );
 }
 
-void Connection::async_write(const std::string& data) {
-    auto self = shared_from_this();
-    auto send_buf = std::make_shared<std::string>(data);
+/**
+ * 송신 큐에 메시지 추가
+ * - 쓰기가 진행 중이 아니면 io 스레드에서 do_write() 시작
+ * - 여러 스레드에서 동시에 호출해도 소켓 쓰기는 항상 한 번에 하나씩 수행
+ */
+void Connection::async_write(const std::string& data, std::size_t frames) {
+    bool start = false;
+    {
+        std::lock_guard<ProfiledMutex> lock(write_mutex_);
+        write_queue_.push_back(data);
+        queued_frames_ += frames;
+        if (Tracer::get_instance().enabled()) {
+            write_trace_id_ = Tracer::current_trace_id();
+        }
+        if (!writing_) {
+            writing_ = true;
+            start = true;
+        }
+    }
+
+    if (start) {
+        auto self = shared_from_this();
+        boost::asio::post(socket_.get_executor(), [self]() { self->do_write(); });
+    }
+}
+
+std::size_t Connection::pending_write_count() const {
+    std::lock_guard<ProfiledMutex> lock(write_mutex_);
+    return write_queue_.size() + write_batch_.size();
+}
+
+/**
+ * 큐에 쌓인 메시지를 모두 꺼내 한 번의 async_write(gather) 로 전송
+ * 완료 후 큐가 비어있지 않으면 반복
+ */
+void Connection::do_write() {
+    {
+        std::lock_guard<ProfiledMutex> lock(write_mutex_);
+        if (write_queue_.empty()) {
+            writing_ = false;
+            return;
+        }
+        write_batch_.assign(std::make_move_iterator(write_queue_.begin()),
+                            std::make_move_iterator(write_queue_.end()));
+        write_queue_.clear();
+        batch_frames_ = queued_frames_;
+        queued_frames_ = 0;
+    }
+
+    const bool tracing = Tracer::get_instance().enabled();
+    const int64_t write_start_us = tracing ? Tracer::get_instance().now_us() : 0;
+    uint64_t trace_id = 0;
+    if (tracing) {
+        std::lock_guard<ProfiledMutex> lock(write_mutex_);
+        trace_id = write_trace_id_;
+    }
+
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.reserve(write_batch_.size());
+    for (const auto& msg : write_batch_) {
+        buffers.push_back(boost::asio::buffer(msg));
+    }
 
+    auto self = shared_from_this();
     boost::asio::async_write(
         socket_,
-        boost::asio::buffer(*send_buf),
-        [this, self, send_buf](const boost::system::error_code& ec, std::size_t bytes_written)
+        buffers,
+        [this, self, tracing, write_start_us, trace_id](const boost::system::error_code& ec, std::size_t bytes_written)
         {
+            if (tracing) {
+                auto& tracer = Tracer::get_instance();
+                tracer.record("write", trace_id, write_start_us, tracer.now_us() - write_start_us);
+            }
+            std::size_t frames = 0;
+            {
+                std::lock_guard<ProfiledMutex> lock(write_mutex_);
+                frames = batch_frames_;
+                write_batch_.clear();
+                batch_frames_ = 0;
+            }
+            traffic_metrics().bytes_out.inc(bytes_written);
+            SERVER_PROBE4(write_complete, PROBE_CONN_ID(this), frames, bytes_written, ec.value());
+            if (!ec) {
+                traffic_metrics().frames_out.inc(frames);
+            }
+
             if (!ec) {
-                // 쓰기 완료 -> WRITE 이벤트
-                // 필요 없음. - WRITE는 편리를 위해 바로 쓰도록 하는게 맞는것으로 보임.
-                std::cout << "[Connection] async_write is completed" << "\n";
+                do_write();
             } else {
+                {
+                    std::lock_guard<ProfiledMutex> lock(write_mutex_);
+                    write_queue_.clear();
+                    queued_frames_ = 0;
+                    writing_ = false;
+                }
+
                 // 쓰기 에러 -> CLOSE로 처리
                 Event ev;
                 ev.main_type = MainEventType::NETWORK;
@@ -215,3 +333,67 @@ void Connection::async_write(const std::string& data) {
         }
     );
 }
+
+int64_t Connection::now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Connection::touch() {
+    last_recv_ms_.store(now_ms(), std::memory_order_relaxed);
+}
+
+int64_t Connection::idle_ms() const {
+    return now_ms() - last_recv_ms_.load(std::memory_order_relaxed);
+}
+
+uint32_t Connection::begin_ping(int64_t timeout_ms) {
+    std::lock_guard<std::mutex> lock(heartbeat_mutex_);
+    int64_t now = now_ms();
+    if (ping_sent_ms_ != 0 && now - ping_sent_ms_ < timeout_ms) {
+        return 0; // 이전 PING 응답 대기 중
+    }
+    ping_sent_ms_ = now;
+    if (++ping_seq_ == 0) {
+        ++ping_seq_; // 0 은 "보내지 않음"
+    }
+    return ping_seq_;
+}
+
+bool Connection::complete_ping(uint32_t seq) {
+    std::lock_guard<std::mutex> lock(heartbeat_mutex_);
+    if (ping_sent_ms_ == 0 || seq != ping_seq_) {
+        return false; // 늦게 도착했거나 모르는 PONG
+    }
+    rtt_.add_sample(static_cast<double>(now_ms() - ping_sent_ms_));
+    ping_sent_ms_ = 0;
+    return true;
+}
+
+RttEstimator Connection::rtt() const {
+    std::lock_guard<std::mutex> lock(heartbeat_mutex_);
+    return rtt_;
+}
+
+void Connection::attach_player(const std::shared_ptr<Player>& player) {
+    std::lock_guard<std::mutex> lock(player_mutex_);
+    player_ = player;
+}
+
+void Connection::detach_player() {
+    std::lock_guard<std::mutex> lock(player_mutex_);
+    player_.reset();
+}
+
+std::shared_ptr<Player> Connection::get_player() const {
+    std::lock_guard<std::mutex> lock(player_mutex_);
+    return player_.lock();
+}
+
+void Connection::close() {
+    auto self = shared_from_this();
+    boost::asio::post(socket_.get_executor(), [self]() {
+        boost::system::error_code ec;
+        self->socket_.close(ec);
+    });
+}
@@ -7,23 +7,62 @@
 #include <string>
 #include <iostream>
 #include <functional>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <chrono>
 #include "event.hpp"
 #include "header.hpp"
+#include "slot_map.hpp"
+#include "rtt_estimator.hpp"
+#include "profiled_mutex.hpp"
 
 using boost::asio::ip::tcp;
 
+class Player;
+
 class Connection : public std::enable_shared_from_this<Connection> {
 public:
     explicit Connection(tcp::socket socket);
 
     void start();
 
-    void async_write(const std::string& response);
+    // 송신 큐에 추가 (어느 스레드에서든 호출 가능)
+    // 실제 쓰기는 io 스레드에서 큐에 쌓인 메시지를 한 번에 모아 수행
+    // frames: response 에 이어붙여진 프로토콜 프레임 수 (송신 프레임 지표 / write_complete 프로브용)
+    void async_write(const std::string& response, std::size_t frames = 1);
+
+    // 송신 큐에 대기 중인 메시지 수
+    std::size_t pending_write_count() const;
+
+    // 하트비트 / 유휴 감지
+    // - touch(): 수신할 때마다 갱신 (헤더 단위)
+    // - begin_ping(): PING 전송 시각 기록 후 시퀀스 반환
+    //   응답 대기 중인 PING 이 timeout_ms 안이면 0 (보내지 않음) → RTT 가 점검 주기보다 길어도 PONG 으로 샘플을 얻음
+    // - complete_ping(): 대기 중인 PING 의 PONG 이면 RTT 샘플 반영
+    void touch();
+    int64_t idle_ms() const;
+    uint32_t begin_ping(int64_t timeout_ms);
+    bool complete_ping(uint32_t seq);
+    RttEstimator rtt() const;
+
+    // 소켓 닫기 (io 스레드에서 수행, 대기 중인 읽기는 에러로 끝나 CLOSE 이벤트 발생)
+    void close();
 
     tcp::socket& get_socket() {
         return socket_;
     }
 
+    // ConnectionManager 가 관리하는 핸들 (ConnectionManager 잠금 하에서만 변경/조회)
+    SlotHandle handle_;        // 커넥션 슬롯
+    SlotHandle player_handle_; // 연결된 플레이어 슬롯
+
+    // 연결된 플레이어 캐시 (JOIN 시 ConnectionManager::register_connection 이 설정, 해제 시 비움)
+    // - 수신 경로(PLAYER_MOVED 병합/처리, PONG)는 전역 잠금 없이 여기서 플레이어를 찾음
+    void attach_player(const std::shared_ptr<Player>& player);
+    void detach_player();
+    std::shared_ptr<Player> get_player() const; // 연결된 플레이어 없으면 nullptr
+
 private:
     void async_read();
     void read_chunk();
@@ -34,7 +73,30 @@ private:
                          const Header& header, 
                          std::size_t bytes_read);
 
+    void do_write();
+
     tcp::socket socket_;
+
+    // 송신 큐
+    mutable ProfiledMutex write_mutex_{"connection_write"};
+    std::deque<std::string> write_queue_;   // 대기 중인 메시지
+    std::vector<std::string> write_batch_;  // 쓰기 중인 메시지 묶음 (io 스레드 전용)
+    std::size_t queued_frames_ = 0;         // write_queue_ 에 담긴 프레임 수
+    std::size_t batch_frames_ = 0;          // write_batch_ 에 담긴 프레임 수
+    bool writing_ = false;                  // 쓰기 진행 여부
+    uint64_t write_trace_id_ = 0;           // 마지막으로 큐에 넣은 메시지의 trace id (추적 모드)
+
+    // 하트비트 (steady_clock 기준 ms)
+    static int64_t now_ms();
+    std::atomic<int64_t> last_recv_ms_;     // 마지막 수신 시각
+    mutable std::mutex heartbeat_mutex_;    // 아래 필드 보호
+    uint32_t ping_seq_ = 0;                 // 마지막으로 보낸 PING 시퀀스
+    int64_t ping_sent_ms_ = 0;              // 응답 대기 중인 PING 전송 시각 (0: 없음)
+    RttEstimator rtt_;
+
+    // 연결된 플레이어 (소유하지 않음)
+    mutable std::mutex player_mutex_;
+    std::weak_ptr<Player> player_;
 };
 
 #endif // CONNECTION_HPP
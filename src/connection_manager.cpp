@@ -1,27 +1,110 @@
 #include "connection_manager.hpp"
+#include "metrics.hpp"
 
-void ConnectionManager::register_connection(std::shared_ptr<Player> player, std::shared_ptr<Connection> connection) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    player_to_connection_[player] = connection;
+namespace {
+
+Gauge& active_connections_gauge()
+{
+    static Gauge& g = MetricsRegistry::get_instance().gauge("asio_server_active_connections", "Accepted connections not yet closed");
+    return g;
+}
+
+Gauge& active_players_gauge()
+{
+    static Gauge& g = MetricsRegistry::get_instance().gauge("asio_server_active_players", "Players bound to a connection");
+    return g;
+}
+
+} // namespace
+
+void ConnectionManager::add_connection(std::shared_ptr<Connection> connection) {
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    if (!connections_.contains(connection->handle_)) {
+        connection->handle_ = connections_.insert(connection);
+    }
+    active_connections_gauge().set(static_cast<int64_t>(connections_.size()));
+}
+
+void ConnectionManager::remove_connection(std::shared_ptr<Connection> connection) {
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    if (!connections_.contains(connection->handle_)) {
+        return;
+    }
+    // 연결된 플레이어도 함께 해제 (unregister_connection 을 먼저 부르지 않아도 슬롯이 남지 않도록)
+    if (auto* bound = players_.get(connection->player_handle_)) {
+        auto player = *bound;
+        player->connection_handle_ = SlotHandle{};
+        players_.erase(player->handle_);
+        player->detach_connection();
+        active_players_gauge().set(static_cast<int64_t>(players_.size()));
+    }
+    connection->player_handle_ = SlotHandle{};
+    connection->detach_player();
+    connections_.erase(connection->handle_);
+    connection->handle_ = SlotHandle{};
+    active_connections_gauge().set(static_cast<int64_t>(connections_.size()));
+}
+
+std::vector<std::shared_ptr<Connection>> ConnectionManager::get_all_connections() const {
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    std::vector<std::shared_ptr<Connection>> result;
+    result.reserve(connections_.size());
+    connections_.for_each([&](SlotHandle, const std::shared_ptr<Connection>& conn) {
+        result.push_back(conn);
+    });
+    return result;
+}
+
+bool ConnectionManager::register_connection(std::shared_ptr<Player> player, std::shared_ptr<Connection> connection) {
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    // 커넥션당 플레이어는 하나: 이미 다른 플레이어가 연결된 커넥션은 거절
+    // (이전 플레이어의 슬롯 / 대기열 / 송신 세션이 남은 채로 덮어쓰지 않도록)
+    if (auto* bound = players_.get(connection->player_handle_)) {
+        if (*bound != player) {
+            return false;
+        }
+    }
+    // 같은 플레이어를 새 커넥션으로 재등록 시 이전 연결 관계 정리 (커넥션 슬롯은 remove_connection 까지 유지)
+    if (auto* old = connections_.get(player->connection_handle_)) {
+        (*old)->player_handle_ = SlotHandle{};
+        (*old)->detach_player();
+    }
+
+    if (!players_.contains(player->handle_)) {
+        player->handle_ = players_.insert(player);
+    }
+    if (!connections_.contains(connection->handle_)) {
+        connection->handle_ = connections_.insert(connection);
+    }
+
+    player->connection_handle_ = connection->handle_;
+    connection->player_handle_ = player->handle_;
+    player->attach_connection(connection);
+    connection->attach_player(player);
+    active_players_gauge().set(static_cast<int64_t>(players_.size()));
+    return true;
 }
 
 void ConnectionManager::unregister_connection(std::shared_ptr<Player> player) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    player_to_connection_.erase(player);
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    if (auto* conn = connections_.get(player->connection_handle_)) {
+        (*conn)->player_handle_ = SlotHandle{};
+        (*conn)->detach_player();
+    }
+    player->connection_handle_ = SlotHandle{};
+    players_.erase(player->handle_);
+    player->detach_connection();
+    active_players_gauge().set(static_cast<int64_t>(players_.size()));
 }
 
 std::shared_ptr<Connection> ConnectionManager::get_connection_for_player(std::shared_ptr<Player> player) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = player_to_connection_.find(player);
-    return it != player_to_connection_.end() ? it->second : nullptr;
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    auto* conn = connections_.get(player->connection_handle_);
+    return conn ? *conn : nullptr;
 }
 
 std::shared_ptr<Player> ConnectionManager::get_player_for_connection(std::shared_ptr<Connection> connection) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto& pair : player_to_connection_) {
-        if (pair.second == connection) {
-            return pair.first;
-        }
-    }
-    return nullptr;
-}
\ No newline at end of file
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    auto* player = players_.get(connection->player_handle_);
+    return player ? *player : nullptr;
+}
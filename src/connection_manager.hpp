@@ -1,11 +1,13 @@
 #ifndef CONNECTION_MANAGER_HPP
 #define CONNECTION_MANAGER_HPP
 
-#include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <vector>
 #include "player.hpp"
 #include "connection.hpp"
+#include "slot_map.hpp"
+#include "profiled_mutex.hpp"
 
 class ConnectionManager {
 public:
@@ -21,7 +23,17 @@ public:
     ConnectionManager& operator=(ConnectionManager&&) = delete;
 
     // 메서드 정의
-    void register_connection(std::shared_ptr<Player> player, std::shared_ptr<Connection> connection);
+    // - 등록/해제 시 Player 의 송신 세션 핸들과 Connection 의 플레이어 캐시도 함께 갱신
+    //   (송신/수신 경로는 ConnectionManager 를 거치지 않음, 여기는 수명 변경 전용)
+    // - 플레이어/커넥션은 세대 핸들(SlotHandle)로 서로를 참조 (해시/문자열 비교 없음)
+    // - 커넥션은 accept 시 add_connection 으로 등록되고 CLOSE 처리 시 remove_connection 으로 해제
+    //   (JOIN 전 커넥션도 하트비트/유휴 감지 대상, 해제 시 연결된 플레이어 슬롯도 함께 해제)
+    void add_connection(std::shared_ptr<Connection> connection);
+    void remove_connection(std::shared_ptr<Connection> connection);
+    std::vector<std::shared_ptr<Connection>> get_all_connections() const;
+
+    // false: 커넥션에 이미 다른 플레이어가 연결되어 있음 (중복 JOIN → 등록하지 않음)
+    bool register_connection(std::shared_ptr<Player> player, std::shared_ptr<Connection> connection);
     void unregister_connection(std::shared_ptr<Player> player);
     std::shared_ptr<Connection> get_connection_for_player(std::shared_ptr<Player> player);
     std::shared_ptr<Player> get_player_for_connection(std::shared_ptr<Connection> connection) const;
@@ -32,8 +44,9 @@ private:
     ~ConnectionManager() = default;
 
     // 데이터 멤버
-    std::unordered_map<std::shared_ptr<Player>, std::shared_ptr<Connection>> player_to_connection_;
-    mutable std::mutex mutex_; // 동시 접근 제어
+    SlotMap<std::shared_ptr<Player>> players_;         // Player::handle_ 로 접근
+    SlotMap<std::shared_ptr<Connection>> connections_; // Connection::handle_ 로 접근
+    mutable ProfiledMutex mutex_{"connection_manager"}; // 동시 접근 제어
 };
 
 #endif // CONNECTION_MANAGER_HPP
\ No newline at end of file
@@ -0,0 +1,297 @@
+#include "cpu_profiler.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <pthread.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+namespace {
+
+constexpr std::size_t kSlotWords = CpuProfiler::kMaxDepth + 1;
+
+// 시그널 핸들러 설치 (한 번만, 이후 유지: 해제 직후 도착한 SIGPROF 가 프로세스를 끝내지 않도록)
+bool install_handler(void (*handler)(int, siginfo_t*, void*))
+{
+    static bool installed = false;
+    if (installed) {
+        return true;
+    }
+    struct sigaction sa {};
+    sa.sa_sigaction = handler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, nullptr) != 0) {
+        return false;
+    }
+    installed = true;
+    return true;
+}
+
+bool set_timer(int64_t period_us)
+{
+    itimerval timer {};
+    timer.it_interval.tv_sec = period_us / 1000000;
+    timer.it_interval.tv_usec = period_us % 1000000;
+    timer.it_value = timer.it_interval;
+    return setitimer(ITIMER_PROF, &timer, nullptr) == 0;
+}
+
+// register_thread() 가 기록한 현재 스레드의 스택 범위 [lo, hi) (기록 전이면 0)
+thread_local uintptr_t t_stack_lo = 0;
+thread_local uintptr_t t_stack_hi = 0;
+
+// 시그널이 끊은 위치의 레지스터 (지원하지 않는 아키텍처면 모두 0)
+struct Registers {
+    uintptr_t pc = 0;
+    uintptr_t fp = 0;
+    uintptr_t sp = 0;
+};
+
+Registers interrupted_registers(void* ucontext)
+{
+    auto* uc = static_cast<ucontext_t*>(ucontext);
+    Registers r;
+#if defined(__x86_64__)
+    r.pc = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RIP]);
+    r.fp = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RBP]);
+    r.sp = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RSP]);
+#elif defined(__aarch64__)
+    r.pc = static_cast<uintptr_t>(uc->uc_mcontext.pc);
+    r.fp = static_cast<uintptr_t>(uc->uc_mcontext.regs[29]);
+    r.sp = static_cast<uintptr_t>(uc->uc_mcontext.sp);
+#else
+    (void)uc;
+#endif
+    return r;
+}
+
+/**
+ * 프레임 포인터 체인 따라가기 (x86-64 / AArch64 공통: [fp] = 이전 fp, [fp + 1워드] = 복귀 주소)
+ * - fp 는 스택 범위 안, 정렬, 엄격히 증가할 때만 읽음 → 잘못된 체인에서도 스택 밖을 읽지 않고 끝남
+ * - 메모리 읽기만 하므로 async-signal-safe
+ */
+int walk_frames(const Registers& regs, uintptr_t* out, int max_depth)
+{
+    if (regs.pc == 0 || max_depth <= 0) {
+        return 0;
+    }
+    int depth = 0;
+    out[depth++] = regs.pc;
+
+    const uintptr_t lo = std::max(t_stack_lo, regs.sp);
+    const uintptr_t hi = t_stack_hi;
+    uintptr_t fp = regs.fp;
+    while (depth < max_depth
+           && fp >= lo && hi >= 2 * sizeof(uintptr_t) && fp <= hi - 2 * sizeof(uintptr_t)
+           && fp % sizeof(uintptr_t) == 0) {
+        auto* frame = reinterpret_cast<const uintptr_t*>(fp);
+        uintptr_t next_fp = frame[0];
+        uintptr_t ret = frame[1];
+        if (ret == 0) {
+            break;
+        }
+        out[depth++] = ret;
+        if (next_fp <= fp) {
+            break;
+        }
+        fp = next_fp;
+    }
+    return depth;
+}
+
+} // namespace
+
+CpuProfiler::~CpuProfiler()
+{
+    stop();
+}
+
+void CpuProfiler::register_thread()
+{
+    pthread_attr_t attr;
+    if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+        return;
+    }
+    void* addr = nullptr;
+    std::size_t size = 0;
+    if (pthread_attr_getstack(&attr, &addr, &size) == 0) {
+        t_stack_lo = reinterpret_cast<uintptr_t>(addr);
+        t_stack_hi = t_stack_lo + size;
+    }
+    pthread_attr_destroy(&attr);
+}
+
+/**
+ * SIGPROF 핸들러 (async-signal-safe 범위만 사용: 잠금 / 할당 / 라이브러리 호출 없음)
+ * - 칸을 atomic 으로 예약하고 끊긴 위치부터 프레임 포인터 체인을 복사
+ *   (ucontext 에서 시작하므로 핸들러/트램펄린 프레임은 처음부터 없음)
+ */
+void CpuProfiler::on_sigprof(int, siginfo_t*, void* ucontext)
+{
+    auto& self = get_instance();
+    int saved_errno = errno;
+    // seq_cst: finish() 의 active_ 해제 → in_handler_ 확인과 순서가 엇갈리지 않도록
+    self.in_handler_.fetch_add(1);
+    if (self.active_.load()) {
+        std::size_t idx = self.next_sample_.fetch_add(1, std::memory_order_relaxed);
+        if (idx < kMaxSamples) {
+            uintptr_t* slot = self.samples_.data() + idx * kSlotWords;
+            int depth = walk_frames(interrupted_registers(ucontext), slot + 1, kMaxDepth);
+            slot[0] = static_cast<uintptr_t>(depth);
+        }
+    }
+    self.in_handler_.fetch_sub(1);
+    errno = saved_errno;
+}
+
+bool CpuProfiler::start(const std::string& path, int duration_ms, int hz)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (status_.running) {
+        return false;
+    }
+    if (worker_.joinable()) {
+        worker_.join(); // 이전 프로파일의 종료 스레드
+    }
+
+    hz = std::clamp(hz, 1, 1000);
+    period_us_ = 1000000 / hz;
+    samples_.assign(kMaxSamples * kSlotWords, 0);
+    next_sample_.store(0);
+
+    if (!install_handler(&CpuProfiler::on_sigprof)) {
+        LOG_ERROR("[CpuProfiler] sigaction failed: " << std::strerror(errno));
+        return false;
+    }
+    active_.store(true);
+    if (!set_timer(period_us_)) {
+        active_.store(false);
+        LOG_ERROR("[CpuProfiler] setitimer failed: " << std::strerror(errno));
+        return false;
+    }
+
+    status_ = Status{};
+    status_.running = true;
+    status_.path = path;
+    status_.hz = hz;
+    stop_requested_ = false;
+    worker_ = std::thread([this, duration_ms]() { run(duration_ms); });
+
+    LOG_INFO("[CpuProfiler] started: " << duration_ms << "ms at " << hz << "Hz -> " << path);
+    return true;
+}
+
+void CpuProfiler::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_requested_ = true;
+    }
+    stop_cv_.notify_all();
+    if (worker_.joinable() && worker_.get_id() != std::this_thread::get_id()) {
+        worker_.join();
+    }
+}
+
+void CpuProfiler::run(int duration_ms)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_cv_.wait_for(lock, std::chrono::milliseconds(std::max(duration_ms, 0)),
+                          [this]() { return stop_requested_; });
+    }
+    finish();
+}
+
+void CpuProfiler::finish()
+{
+    set_timer(0);
+    active_.store(false);
+    // 실행 중인 핸들러가 끝날 때까지 대기 (버퍼를 읽기 전에)
+    while (in_handler_.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    bool written = write_profile();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t taken = next_sample_.load();
+    status_.samples = std::min(taken, kMaxSamples);
+    status_.dropped = taken > kMaxSamples ? taken - kMaxSamples : 0;
+    status_.written = written;
+    status_.running = false;
+    samples_.clear();
+    samples_.shrink_to_fit();
+    LOG_INFO("[CpuProfiler] finished: " << status_.samples << " samples (" << status_.dropped
+             << " dropped) -> " << status_.path << (written ? "" : " (write failed)"));
+}
+
+/**
+ * gperftools CPU 프로파일 형식 (워드 = uintptr_t, 호스트 바이트 순서)
+ * - 헤더: 0, 3, 0, 샘플 주기(us), 0
+ * - 레코드: 샘플 수, 깊이, pc[깊이]  (같은 스택은 하나로 묶음)
+ * - 끝 표시: 0, 1, 0
+ * - 이어서 /proc/self/maps 텍스트 (pprof 가 주소 → 심볼 변환에 사용)
+ */
+bool CpuProfiler::write_profile()
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        path = status_.path;
+    }
+
+    std::map<std::vector<uintptr_t>, uintptr_t> stacks;
+    std::size_t count = std::min(next_sample_.load(), kMaxSamples);
+    for (std::size_t i = 0; i < count; ++i) {
+        const uintptr_t* slot = samples_.data() + i * kSlotWords;
+        if (slot[0] == 0) {
+            continue;
+        }
+        stacks[std::vector<uintptr_t>(slot + 1, slot + 1 + slot[0])] += 1;
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        LOG_ERROR("[CpuProfiler] cannot open " << path);
+        return false;
+    }
+    auto put = [&out](uintptr_t word) {
+        out.write(reinterpret_cast<const char*>(&word), sizeof(word));
+    };
+
+    put(0);
+    put(3);
+    put(0);
+    put(static_cast<uintptr_t>(period_us_));
+    put(0);
+    for (const auto& [pcs, n] : stacks) {
+        put(n);
+        put(pcs.size());
+        for (uintptr_t pc : pcs) {
+            put(pc);
+        }
+    }
+    put(0);
+    put(1);
+    put(0);
+
+    std::ifstream maps("/proc/self/maps");
+    out << maps.rdbuf();
+    return static_cast<bool>(out);
+}
+
+CpuProfiler::Status CpuProfiler::status() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Status s = status_;
+    if (s.running) {
+        s.samples = std::min(next_sample_.load(), kMaxSamples);
+    }
+    return s;
+}
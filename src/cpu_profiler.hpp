@@ -0,0 +1,81 @@
+#ifndef CPU_PROFILER_HPP
+#define CPU_PROFILER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * CpuProfiler
+ *  - 실행 중 요청 시 CPU 샘플링 (재시작 / 외부 프로파일러 없이)
+ *  - setitimer(ITIMER_PROF) → SIGPROF 가 CPU 를 쓰고 있는 스레드(io / 워커)에 전달,
+ *    시그널 핸들러는 ucontext 의 프레임 포인터 체인을 따라가 미리 잡아둔 버퍼에 복사만 함
+ *    (glibc backtrace 는 로더 잠금을 잡을 수 있어 쓰지 않음 / -fno-omit-frame-pointer 로 빌드)
+ *  - 스택은 register_thread() 로 범위를 기록한 스레드만 따라감 (그 외 스레드는 끊긴 위치 pc 하나)
+ *  - duration_ms 후 (또는 stop()) 같은 스택을 묶어 gperftools 바이너리 형식(legacy pprof)으로 기록
+ *    → pprof --text ./asio_server cpu.prof 등으로 분석 (파일 끝에 /proc/self/maps 포함)
+ *  - 한 번에 하나의 프로파일만 실행
+ */
+class CpuProfiler {
+public:
+    static constexpr int kMaxDepth = 48;          // 샘플당 최대 스택 깊이
+    static constexpr std::size_t kMaxSamples = 1 << 16;
+
+    struct Status {
+        bool running = false;
+        std::string path;        // 기록 중 / 마지막으로 기록한 파일
+        int hz = 0;
+        uint64_t samples = 0;    // 마지막 프로파일 샘플 수 (실행 중이면 지금까지)
+        uint64_t dropped = 0;    // 버퍼가 가득 차 버린 샘플 수
+        bool written = false;    // 마지막 프로파일 파일 기록 성공 여부
+    };
+
+    static CpuProfiler& get_instance() {
+        static CpuProfiler instance;
+        return instance;
+    }
+
+    CpuProfiler(const CpuProfiler&) = delete;
+    CpuProfiler& operator=(const CpuProfiler&) = delete;
+
+    // 프로파일 시작 (이미 실행 중이거나 타이머 설정 실패 시 false)
+    bool start(const std::string& path, int duration_ms, int hz = 100);
+
+    // 즉시 종료 후 파일 기록 (실행 중이 아니면 아무것도 하지 않음)
+    void stop();
+
+    Status status() const;
+
+    // 현재 스레드의 스택 범위 기록 (샘플링할 스레드 시작 시 한 번, 시그널 핸들러 밖에서)
+    static void register_thread();
+
+private:
+    CpuProfiler() = default;
+    ~CpuProfiler();
+
+    static void on_sigprof(int sig, siginfo_t* info, void* ucontext);
+
+    void run(int duration_ms);  // 종료 대기 스레드
+    void finish();              // 타이머 해제 + 파일 기록
+    bool write_profile();
+
+    mutable std::mutex mutex_;  // 아래 상태 / 시작·종료 직렬화
+    std::condition_variable stop_cv_;
+    bool stop_requested_ = false;
+    std::thread worker_;
+    Status status_;
+    int64_t period_us_ = 0;
+
+    // 샘플 버퍼: 칸마다 [깊이, pc...] (kMaxDepth + 1 워드)
+    std::vector<uintptr_t> samples_;
+    std::atomic<bool> active_{false};
+    std::atomic<std::size_t> next_sample_{0};
+    std::atomic<int> in_handler_{0};
+};
+
+#endif // CPU_PROFILER_HPP
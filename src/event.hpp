@@ -6,6 +6,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <chrono>
 
 // 전방 선언
 class Connection;
@@ -21,6 +22,9 @@ enum class NetworkSubType : uint16_t {
     JOIN  = 101,
     LEFT  = 102,
     CLOSE = 103,
+    PING  = 104, // 하트비트 요청 (서버 → 클라이언트, 클라이언트 → 서버 모두 가능)
+    PONG  = 105, // 하트비트 응답 (PING 의 seq 를 그대로 돌려줌)
+    HEARTBEAT = 106, // 내부 이벤트: PING 전송 + 유휴 커넥션 점검 (클라이언트로 전송하지 않음)
     // ... etc
 };
 
@@ -33,6 +37,13 @@ enum class GameSubType : uint16_t {
     PLAYER_COME_OUT_MAP  = 206, // 플레이어가 맵에서 나감
     PLAYER_FINISHED      = 207, // 플레이어가 도착
     GAME_END             = 208, // 게임 종료
+    GAME_TICK            = 209, // 틱 모드: 맵 단위 위치 스냅샷
+    PLAYER_ENTER_VIEW    = 210, // 관심 영역: 다른 플레이어가 시야에 들어옴
+    PLAYER_LEAVE_VIEW    = 211, // 관심 영역: 다른 플레이어가 시야에서 벗어남
+    TERRAIN_CHUNK        = 212, // 지형 스트리밍: 탐색 영역 주변 장애물 청크
+    MATCHMAKE            = 213, // 내부 이벤트: 매치메이킹 주기 실행 (클라이언트로 전송하지 않음)
+    SIMULATION_STEP      = 214, // 내부 이벤트: 방 고정 스텝 시뮬레이션 (클라이언트로 전송하지 않음)
+    ROOM_REAP            = 215, // 내부 이벤트: 빈 방 / 시간 초과 방 점검 (클라이언트로 전송하지 않음)
     // ... etc
 };
 
@@ -51,8 +62,14 @@ struct Event {
 
     // 추가 데이터: json/문자열/room_id 등
     std::vector<char> data; 
-    int room_id = -1;        // 룸 식별자
+    uint64_t room_id = 0;    // 룸 식별자 (방 슬롯 핸들 값, 0: 없음)
     std::string player_id;   // 플레이어 식별자
+
+    // 생성 시각 (네트워크 이벤트: 프레임 수신 완료 시각) → 핸들러 완료까지 지연 측정용
+    std::chrono::steady_clock::time_point created_at = std::chrono::steady_clock::now();
+
+    // 요청 추적 id (추적 모드에서만 발급, 0: 없음)
+    uint64_t trace_id = 0;
 };
 
 #endif // EVENT_HPP
@@ -1,77 +1,155 @@
 #include "game_manager.hpp"
+#include "metrics.hpp"
+#include "probes.hpp"
 #include <algorithm>
-#include <iostream>
 
-GameManager::GameManager() {}
+static Matchmaker::Options make_matchmaker_options(const ServerConfig& config)
+{
+    Matchmaker::Options options;
+    options.room_size = static_cast<std::size_t>(std::max(config.room_size, 1));
+    options.min_fill = static_cast<std::size_t>(std::max(config.min_room_fill, 1));
+    options.max_wait_ms = config.matchmaking_max_wait_ms;
+    options.rtt_bucket_ms = config.matchmaking_rtt_bucket_ms;
+    return options;
+}
+
+GameManager::GameManager(const ServerConfig& config)
+    : config_(config)
+    , matchmaker_(make_matchmaker_options(config))
+{
+}
 GameManager::~GameManager() {}
 
 // 대기열
-void GameManager::add_waiting_player(std::shared_ptr<Player> p)
+void GameManager::add_waiting_player(std::shared_ptr<Player> p, int rtt_ms)
 {
-    std::lock_guard<std::mutex> lock(waiting_mtx_);
-    waiting_players_.push_back(p);
+    matchmaker_.enqueue(p, rtt_ms);
 }
 
-bool GameManager::remove_waiting_player(std::shared_ptr<Player> p)
+void GameManager::add_waiting_player(std::shared_ptr<Player> p, int rtt_ms, Matchmaker::Clock::time_point enqueued_at)
 {
-    std::lock_guard<std::mutex> lock(waiting_mtx_);
-    auto it = std::find(waiting_players_.begin(), waiting_players_.end(), p);
-    if (it != waiting_players_.end()) {
-        waiting_players_.erase(it);
-        return true;
-    }
-    return false;
+    matchmaker_.enqueue(p, rtt_ms, enqueued_at);
 }
 
-std::vector<std::shared_ptr<Player>> GameManager::pop_waiting_players(std::size_t count)
+bool GameManager::remove_waiting_player(std::shared_ptr<Player> p)
 {
-    std::lock_guard<std::mutex> lock(waiting_mtx_);
-    if (count > waiting_players_.size()) count = waiting_players_.size();
-    std::vector<std::shared_ptr<Player>> to_move(
-        waiting_players_.begin(),
-        waiting_players_.begin() + count
-    );
-    waiting_players_.erase(waiting_players_.begin(), waiting_players_.begin() + count);
-    return to_move;
+    return matchmaker_.remove(p);
 }
 
 size_t GameManager::waiting_count() const
 {
-    std::lock_guard<std::mutex> lock(waiting_mtx_);
-    return waiting_players_.size();
+    return matchmaker_.size();
+}
+
+std::vector<Matchmaker::Group> GameManager::form_matches()
+{
+    return matchmaker_.form_groups();
 }
 
 // rooms
-std::shared_ptr<Room> GameManager::create_room(int room_id)
+namespace {
+
+Gauge& active_rooms_gauge()
+{
+    static Gauge& g = MetricsRegistry::get_instance().gauge("asio_server_active_rooms", "Rooms currently alive");
+    return g;
+}
+
+} // namespace
+
+std::shared_ptr<Room> GameManager::create_room()
 {
-    auto r = std::make_shared<Room>(room_id);
-    std::lock_guard<std::mutex> lock(rooms_mtx_);
-    rooms_.push_back(r);
+    auto r = reserve_room();
+    publish_room(r);
     return r;
 }
 
-std::shared_ptr<Room> GameManager::find_room(int room_id)
+/**
+ * 슬롯을 먼저 확보해 핸들 값을 방 id 로 사용
+ * - 슬롯은 publish_room 전까지 비어 있음 → 조회/점검 대상이 아님
+ * - Room 생성이 실패하면 빈 슬롯을 남기지 않도록 되돌림
+ */
+std::shared_ptr<Room> GameManager::reserve_room()
 {
-    std::lock_guard<std::mutex> lock(rooms_mtx_);
-    for (auto& r : rooms_) {
-        if (r->id_ == room_id) return r;
+    std::lock_guard<ProfiledMutex> lock(rooms_mtx_);
+    SlotHandle handle = rooms_.insert(nullptr);
+    std::shared_ptr<Room> r;
+    try {
+        r = std::make_shared<Room>(handle.value());
+    } catch (...) {
+        rooms_.erase(handle);
+        throw;
     }
-    return nullptr;
+    RoomUsage::Budget budget;
+    budget.window_ms = config_.room_budget_window_ms;
+    budget.cpu_ms = static_cast<uint64_t>(std::max(config_.room_cpu_budget_ms, 0));
+    budget.msgs_in = static_cast<uint64_t>(std::max(config_.room_input_budget, 0));
+    budget.bytes_out = static_cast<uint64_t>(std::max(config_.room_output_budget_bytes, 0));
+    r->usage().set_budget(budget);
+    active_rooms_gauge().set(static_cast<int64_t>(rooms_.size()));
+    return r;
 }
 
-void GameManager::remove_room(int room_id)
+void GameManager::publish_room(const std::shared_ptr<Room>& room)
 {
-    std::lock_guard<std::mutex> lock(rooms_mtx_);
-    auto it = std::remove_if(rooms_.begin(), rooms_.end(), [room_id](auto& r){
-        return (r->id_ == room_id);
-    });
-    if (it != rooms_.end()) {
-        rooms_.erase(it, rooms_.end());
+    std::lock_guard<ProfiledMutex> lock(rooms_mtx_);
+    if (auto* r = rooms_.get(SlotHandle::from_value(room->id_))) {
+        *r = room;
+    }
+}
+
+std::shared_ptr<Room> GameManager::find_room(uint64_t room_id)
+{
+    std::lock_guard<ProfiledMutex> lock(rooms_mtx_);
+    auto* r = rooms_.get(SlotHandle::from_value(room_id));
+    return r ? *r : nullptr;
+}
+
+void GameManager::remove_room(uint64_t room_id)
+{
+    std::lock_guard<ProfiledMutex> lock(rooms_mtx_);
+    auto handle = SlotHandle::from_value(room_id);
+    if (auto* r = rooms_.get(handle)) {
+        if (*r) {
+            auto age = std::chrono::steady_clock::now() - (*r)->created_at_;
+            SERVER_PROBE2(room_end, room_id, std::chrono::duration_cast<std::chrono::milliseconds>(age).count());
+        }
+        rooms_.erase(handle); // 미공개 방도 제거 (방 생성 실패 시)
+    }
+    active_rooms_gauge().set(static_cast<int64_t>(rooms_.size()));
+}
+
+std::vector<std::shared_ptr<Room>> GameManager::next_rooms_to_check(std::size_t count)
+{
+    std::lock_guard<ProfiledMutex> lock(rooms_mtx_);
+    std::vector<std::shared_ptr<Room>> result;
+    const std::size_t capacity = rooms_.capacity();
+    if (capacity == 0) {
+        return result;
+    }
+
+    // 빈 슬롯 포함 최대 한 바퀴만 확인
+    for (std::size_t scanned = 0; scanned < capacity && result.size() < count; ++scanned) {
+        if (reap_cursor_ >= capacity) {
+            reap_cursor_ = 0;
+        }
+        SlotHandle handle = rooms_.handle_at(reap_cursor_++);
+        if (auto* r = rooms_.get(handle); r && *r) {
+            result.push_back(*r);
+        }
     }
+    return result;
 }
 
 std::vector<std::shared_ptr<Room>> GameManager::get_all_rooms() const
 {
-    std::lock_guard<std::mutex> lock(rooms_mtx_);
-    return rooms_; // copy
+    std::lock_guard<ProfiledMutex> lock(rooms_mtx_);
+    std::vector<std::shared_ptr<Room>> result;
+    result.reserve(rooms_.size());
+    rooms_.for_each([&result](SlotHandle, const std::shared_ptr<Room>& r) {
+        if (r) {
+            result.push_back(r); // 미공개 방 제외
+        }
+    });
+    return result;
 }
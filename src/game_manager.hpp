@@ -7,37 +7,59 @@
 #include <atomic>
 #include "room.hpp"
 #include "player.hpp"
+#include "server_config.hpp"
+#include "slot_map.hpp"
+#include "matchmaker.hpp"
+#include "profiled_mutex.hpp"
 
 /**
  * GameManager
  *  - “상태 저장소” 역할
- *  - 대기열(waiting_players_)과 rooms_ 목록
+ *  - 대기열(matchmaker_)과 rooms_ 목록
  *  - "로직"은 하지 않고, 단순 get/set + thread-safe
  */
 class GameManager {
 public:
-    GameManager();
+    explicit GameManager(const ServerConfig& config = ServerConfig());
     ~GameManager();
 
-    // 대기열(waiting_players_)
-    void add_waiting_player(std::shared_ptr<Player> p);
+    // 서버 설정 (읽기 전용)
+    const ServerConfig& config() const { return config_; }
+
+    // 대기열(matchmaker_)
+    void add_waiting_player(std::shared_ptr<Player> p, int rtt_ms = 0);
+    // 원래 등록 시각으로 되돌림 (편성 후 방 생성 실패 시)
+    void add_waiting_player(std::shared_ptr<Player> p, int rtt_ms, Matchmaker::Clock::time_point enqueued_at);
     bool remove_waiting_player(std::shared_ptr<Player> p);
-    std::vector<std::shared_ptr<Player>> pop_waiting_players(std::size_t count);
     size_t waiting_count() const;
 
+    // 매치메이킹: 편성 가능한 방(플레이어 묶음)을 모두 꺼냄
+    std::vector<Matchmaker::Group> form_matches();
+    Matchmaker& matchmaker() { return matchmaker_; }
+
     // rooms
-    std::shared_ptr<Room> create_room(int room_id);
-    std::shared_ptr<Room> find_room(int room_id);
-    void remove_room(int room_id);
+    //  - 방 id 는 슬롯 핸들 값 (SlotHandle::value) → 조회는 인덱스 접근 + 세대 비교
+    //  - create_room: 만들고 바로 공개
+    //  - reserve_room: id 만 확보한 미공개 방 (find_room / get_all_rooms / 방 정리에 나타나지 않음)
+    //    → 플레이어 입장 후 publish_room 으로 공개 (입장 전 빈 방이 정리되지 않도록)
+    std::shared_ptr<Room> create_room();
+    std::shared_ptr<Room> reserve_room();
+    void publish_room(const std::shared_ptr<Room>& room);
+    std::shared_ptr<Room> find_room(uint64_t room_id);
+    void remove_room(uint64_t room_id);
     std::vector<std::shared_ptr<Room>> get_all_rooms() const;
-    int current_room_id = 0;
+
+    // 방 정리(reaper): 커서 위치부터 최대 count 개 방을 반환하고 커서를 옮김 (한 바퀴 돌면 처음부터)
+    std::vector<std::shared_ptr<Room>> next_rooms_to_check(std::size_t count);
 
 private:
-    mutable std::mutex waiting_mtx_;
-    std::vector<std::shared_ptr<Player>> waiting_players_;
+    const ServerConfig config_;
+
+    Matchmaker matchmaker_;
 
-    mutable std::mutex rooms_mtx_;
-    std::vector<std::shared_ptr<Room>> rooms_;
+    mutable ProfiledMutex rooms_mtx_{"game_manager_rooms"};
+    SlotMap<std::shared_ptr<Room>> rooms_;
+    uint32_t reap_cursor_ = 0; // 방 정리 커서 (rooms_ 슬롯 인덱스)
 };
 
 #endif // GAME_MANAGER_HPP
@@ -3,8 +3,10 @@
 
 #include "game_result.hpp"
 #include "player.hpp"
+#include "profiled_mutex.hpp"
 #include <string>
 #include <vector>
+#include <memory_resource>
 #include <mutex>
 #include <chrono>
 #include <nlohmann/json.hpp>
@@ -34,24 +36,26 @@ public:
         }
     };
 
-    explicit GameResult(int room_id);
+    // resource: 결과 목록 할당 풀 (방 전용 풀)
+    explicit GameResult(uint64_t room_id,
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     // 게임 시작 시간을 기록
     void set_game_start_time();
     // 게임 종료 시간을 기록하고, 진행 시간(초 단위) 계산
     void set_game_end_time();
 
-    // 플레이어 결과 추가 (순서대로 rank 부여)
-    void add_player_result(const std::shared_ptr<Player>& player);
+    // 플레이어 결과 추가 (순서대로 rank 부여, distance: 방 상태의 이동 거리)
+    void add_player_result(const std::shared_ptr<Player>& player, int distance);
 
     // JSON으로 변환
     nlohmann::json to_json() const;
 
 private:
-    int room_id_;                         // 방 ID
+    uint64_t room_id_;                    // 방 ID
     int current_rank_ = 1;                // 현재 순위
-    std::vector<PlayerResult> results_;   // 플레이어 결과 목록
-    mutable std::mutex result_mutex_;     // 동기화
+    std::pmr::vector<PlayerResult> results_; // 플레이어 결과 목록
+    mutable ProfiledMutex result_mutex_{"game_result"}; // 동기화
 
     // 게임 관련 시간 정보 (타임스탬프)
     std::chrono::system_clock::time_point game_start_time_;
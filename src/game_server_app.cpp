@@ -1,18 +1,43 @@
 #include "game_server_app.hpp"
-#include <iostream>
-
-GameServerApp::GameServerApp(unsigned short port)
+#include "timer_service.hpp"
+#include "logger.hpp"
+#include "metrics.hpp"
+#include "tracer.hpp"
+#include "profiled_mutex.hpp"
+#include "cpu_profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+GameServerApp::GameServerApp(const ServerConfig& config)
+    : config_(config)
 {
-    std::cout << "[GameServerApp] Constructor\n";
+    // 0) 로그 설정 (비동기 로거: 레벨 / 출력 파일)
+    Logger::get_instance().set_level(Logger::parse_level(config_.log_level));
+    if (!Logger::get_instance().set_output_file(config_.log_file)) {
+        LOG_ERROR("[GameServerApp] cannot open log file: " << config_.log_file);
+    }
+
+    // 0-1) 요청 추적 설정
+    Tracer::get_instance().set_buffer_capacity(static_cast<std::size_t>(std::max(config_.trace_buffer_spans, 1)));
+    Tracer::get_instance().set_enabled(config_.trace_enabled);
+
+    // 0-2) 뮤텍스 경합 프로파일링
+    ProfiledMutex::set_enabled(config_.mutex_profiling);
+
+    LOG_INFO("[GameServerApp] Constructor");
 
     // 1) 스레드풀 생성 (기본 스레드 개수: std::thread::hardware_concurrency())
     thread_pool_ = std::make_unique<ThreadPool>();
 
     // 2) 게임 매니저 생성
-    game_manager_ = std::make_unique<GameManager>();
+    game_manager_ = std::make_unique<GameManager>(config_);
+
+    // 2) 타이머 서비스 생성 (타이밍 휠)
+    TimerService::initialize_instance(io_context_, config_.timer_resolution_ms);
 
     // 2) 리액터 생성 (포트 번호와 thread_pool 참조)
-    Reactor::initialize_instance(io_context_, port, *thread_pool_, *game_manager_);
+    Reactor::initialize_instance(io_context_, config_.port, *thread_pool_, *game_manager_);
 
 
 }
@@ -20,32 +45,64 @@ GameServerApp::GameServerApp(unsigned short port)
 GameServerApp::~GameServerApp()
 {
     stop(); // 안전하게 stop() 호출
-    std::cout << "[GameServerApp] Destructor\n";
+    LOG_INFO("[GameServerApp] Destructor");
 }
 
 void GameServerApp::start()
 {
     if (running_) {
-        std::cout << "[GameServerApp::start] Already running.\n";
+        LOG_WARN("[GameServerApp::start] Already running.");
         return;
     }
 
     running_ = true;
 
     // 1) Reactor 시작: async_accept 등
-    std::cout << "[GameServerApp] Starting Reactor...\n";
+    LOG_INFO("[GameServerApp] Starting Reactor...");
     Reactor::get_instance().run();
 
+    // 1-1) 매치메이킹 주기 시작 (이후 핸들러가 스스로 재예약)
+    if (config_.matchmaking_interval_ms > 0) {
+        Event ev;
+        ev.main_type = MainEventType::GAME;
+        ev.sub_type  = (uint16_t)GameSubType::MATCHMAKE;
+        Reactor::get_instance().enqueue_event(ev);
+    }
+
+    // 1-2) 방 점검 주기 시작
+    if (config_.room_reap_interval_ms > 0) {
+        Event ev;
+        ev.main_type = MainEventType::GAME;
+        ev.sub_type  = (uint16_t)GameSubType::ROOM_REAP;
+        Reactor::get_instance().enqueue_event(ev);
+    }
+
+    // 1-3) 하트비트 / 유휴 커넥션 점검 주기 시작
+    NetworkEventHandler::schedule_heartbeat(NetworkEventHandler::heartbeat_sweep_interval_ms(config_));
+
+    // 1-4) 지표 스냅샷 파일 기록 시작
+    schedule_metrics_dump();
+
+    // 1-5) 운영/진단용 HTTP 엔드포인트 (자체 io_context 스레드)
+    if (config_.admin_port > 0) {
+        admin_server_ = std::make_unique<AdminServer>(config_, *game_manager_, *thread_pool_);
+        admin_server_->start(config_.admin_port);
+    }
+
+    // 1-6) CPU 프로파일 요청 시그널 (kill -USR2 <pid>)
+    profile_signal_ = std::make_unique<boost::asio::signal_set>(io_context_, SIGUSR2);
+    wait_profile_signal();
 
     // 2) io_context.run()을 블로킹으로 실행(= 메인 스레드 사용)
     //    - 만약 여러 스레드에서 io_context를 돌리고 싶다면,
     //      thread_pool_->enqueue_task([this](){ io_context_.run(); });
     //      처럼 여러 번 실행하면 됩니다. 
     //    - 여기서는 단일 스레드 예시
-    std::cout << "[GameServerApp] Running io_context...\n";
+    LOG_INFO("[GameServerApp] Running io_context...");
+    CpuProfiler::register_thread();
     io_context_.run();
 
-    std::cout << "[GameServerApp] start() done.\n";
+    LOG_INFO("[GameServerApp] start() done.");
 }
 
 void GameServerApp::stop()
@@ -57,6 +114,57 @@ void GameServerApp::stop()
 
     // io_context 정지
     io_context_.stop();
+    if (admin_server_) {
+        admin_server_->stop();
+    }
+
+    LOG_INFO("[GameServerApp] stop() called.");
+}
+
+void GameServerApp::wait_profile_signal()
+{
+    profile_signal_->async_wait([this](const boost::system::error_code& ec, int) {
+        if (ec) {
+            return;
+        }
+        if (!CpuProfiler::get_instance().start(config_.cpu_profile_file,
+                                                config_.cpu_profile_seconds * 1000, config_.cpu_profile_hz)) {
+            LOG_WARN("[GameServerApp] CPU profile already running or failed to start");
+        }
+        wait_profile_signal();
+    });
+}
+
+/**
+ * 지표 스냅샷 파일 기록 (Prometheus 텍스트 형식)
+ * - 타이머 콜백(io 스레드)은 스레드풀에 기록 작업만 넘기고, 기록 후 다음 주기 예약
+ * - node_exporter textfile collector 등이 읽다가 잘린 파일을 보지 않도록 임시 파일에 쓴 뒤 rename
+ */
+void GameServerApp::schedule_metrics_dump()
+{
+    if (config_.metrics_file.empty() || config_.metrics_dump_interval_ms <= 0) {
+        return;
+    }
+    TimerService::get_instance().schedule_after(std::chrono::milliseconds(config_.metrics_dump_interval_ms), [this]() {
+        thread_pool_->enqueue_task([this]() {
+            write_metrics_file();
+            schedule_metrics_dump();
+        });
+    });
+}
 
-    std::cout << "[GameServerApp] stop() called.\n";
+void GameServerApp::write_metrics_file() const
+{
+    const std::string tmp_path = config_.metrics_file + ".tmp";
+    {
+        std::ofstream ofs(tmp_path, std::ios::trunc);
+        if (!ofs) {
+            LOG_ERROR("[GameServerApp] cannot write metrics file: " << tmp_path);
+            return;
+        }
+        ofs << MetricsRegistry::get_instance().render_prometheus();
+    }
+    if (std::rename(tmp_path.c_str(), config_.metrics_file.c_str()) != 0) {
+        LOG_ERROR("[GameServerApp] cannot rename metrics file: " << config_.metrics_file);
+    }
 }
@@ -5,6 +5,8 @@
 #include "game_manager.hpp"
 #include "reactor.hpp"
 #include "thread_pool.hpp"
+#include "server_config.hpp"
+#include "admin_server.hpp"
 
 /**
  * 상위(Orchestrator) 역할을 하는 클래스.
@@ -13,8 +15,8 @@
  */
 class GameServerApp {
 public:
-    // 예시로 포트 번호를 인자로 받도록 구성
-    explicit GameServerApp(unsigned short port = 12345);
+    // 서버 설정(포트, 틱 모드 등)을 인자로 받도록 구성
+    explicit GameServerApp(const ServerConfig& config = ServerConfig());
     ~GameServerApp();
 
     // 서버 시작(초기화 + 리액터 run 등)
@@ -24,13 +26,25 @@ public:
     void stop();
 
 private:
+    // 지표 스냅샷 파일 기록 주기 예약 (metrics_file 설정 시)
+    void schedule_metrics_dump();
+    void write_metrics_file() const;
+
+    // SIGUSR2 수신 시 CPU 프로파일 시작 (수신할 때마다 다시 대기)
+    void wait_profile_signal();
+
     // 서버 실행 여부
     bool running_ = false;
 
+    // 서버 설정
+    ServerConfig config_;
+
     // 주요 구성 요소
     boost::asio::io_context io_context_;
     std::unique_ptr<ThreadPool> thread_pool_;
     std::unique_ptr<GameManager> game_manager_;
+    std::unique_ptr<AdminServer> admin_server_; // admin_port 설정 시에만 생성
+    std::unique_ptr<boost::asio::signal_set> profile_signal_;
 };
 
 #endif // GAME_SERVER_APP_HPP
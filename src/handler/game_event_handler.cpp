@@ -3,8 +3,23 @@
 #include "reactor.hpp"
 #include "utils.hpp"
 #include "game_result.hpp"
+#include "timer_service.hpp"
+#include "logger.hpp"
+#include "probes.hpp"
+#include "output_batch.hpp"
+#include "metrics.hpp"
 #include <nlohmann/json.hpp>
-#include <iostream>
+#include <algorithm>
+
+namespace {
+
+Counter& throttled_inputs_counter()
+{
+    static Counter& c = MetricsRegistry::get_instance().counter("asio_server_room_throttled_inputs_total", "Move inputs dropped because the room exceeded its budget");
+    return c;
+}
+
+} // namespace
 
 GameEventHandler::GameEventHandler(GameManager& gm, boost::asio::io_context& ioc)
     : game_manager_(gm)
@@ -15,13 +30,31 @@ GameEventHandler::GameEventHandler(GameManager& gm, boost::asio::io_context& ioc
 void GameEventHandler::handle_event(const Event& event)
 {
     if (event.main_type != MainEventType::GAME) {
-        std::cerr << "[WARNING] GameEventHandler got non-GAME event.\n";
+        LOG_WARN("[GameEventHandler] got non-GAME event.");
         return;
     }
 
+    // 클라이언트가 보낼 수 있는 GAME 이벤트는 PLAYER_MOVED 뿐
+    // 나머지(MATCHMAKE, ROOM_REAP, GAME_TICK 등)는 서버 내부 이벤트 → 커넥션이 붙어 오면 무시
+    // (클라이언트 프레임이 타이머 재예약 체인을 추가로 만들지 않도록)
+    if (event.connection.has_value() && event.sub_type != (uint16_t)GameSubType::PLAYER_MOVED) {
+        LOG_WARN("[GameEventHandler] client sent internal sub_type=" << event.sub_type << ", ignored.");
+        return;
+    }
+
+    // PLAYER_MOVED: 플레이어(커넥션 캐시)와 방을 여기서 한 번만 찾아 처리 함수로 넘김
+    // 방별 자원 사용량: 이 이벤트의 CPU 시간 / 송신량을 해당 방에 반영
+    std::shared_ptr<Player> player;
+    if (event.sub_type == (uint16_t)GameSubType::PLAYER_MOVED) {
+        player = player_for_event(event);
+    }
+    auto room = room_for_event(event, player);
+    RoomUsage::Scope usage(room ? &room->usage() : nullptr);
+
     switch (static_cast<GameSubType>(event.sub_type)) {
     case GameSubType::ROOM_CREATE:
-        handle_room_create(event);
+    case GameSubType::MATCHMAKE:
+        handle_matchmake(event);
         break;
     case GameSubType::GAME_COUNTDOWN:
         handle_game_countdown(event);
@@ -30,58 +63,153 @@ void GameEventHandler::handle_event(const Event& event)
         handle_game_start(event);
         break;
     case GameSubType::PLAYER_MOVED:
-        handle_player_moved(event);
+        handle_player_moved(player, room);
         break;
     case GameSubType::PLAYER_COME_IN_MAP:
     case GameSubType::PLAYER_COME_OUT_MAP:
     case GameSubType::PLAYER_FINISHED:
+    case GameSubType::PLAYER_ENTER_VIEW:
+    case GameSubType::PLAYER_LEAVE_VIEW:
+    case GameSubType::TERRAIN_CHUNK:
         // 이벤트로 처리하지 않음 (PLAYER_MOVED 내에서 로직으로 처리)
         break;
     case GameSubType::GAME_END:
         handle_game_end(event);
         break;
+    case GameSubType::GAME_TICK:
+        handle_game_tick(event);
+        break;
+    case GameSubType::SIMULATION_STEP:
+        handle_simulation_step(event);
+        break;
+    case GameSubType::ROOM_REAP:
+        handle_room_reap(event);
+        break;
     default:
-        std::cerr << "[GameEventHandler] Unknown sub_type=" << event.sub_type << "\n";
+        LOG_WARN("[GameEventHandler] Unknown sub_type=" << event.sub_type);
+    }
+}
+
+std::shared_ptr<Player> GameEventHandler::player_for_event(const Event& ev)
+{
+    if (!ev.connection.has_value()) {
+        return nullptr;
+    }
+    auto conn = ev.connection->lock();
+    return conn ? conn->get_player() : nullptr;
+}
+
+std::shared_ptr<Room> GameEventHandler::room_for_event(const Event& ev, const std::shared_ptr<Player>& player)
+{
+    uint64_t room_id = player ? player->room_id() : ev.room_id;
+    return room_id != 0 ? game_manager_.find_room(room_id) : nullptr;
+}
+
+/**
+ * MATCHMAKE (ROOM_CREATE 도 같은 처리):
+ * - 매치메이커가 편성한 플레이어 묶음마다 방 생성 (한 번에 여러 방)
+ * - MATCHMAKE 이고 편성 주기가 설정되어 있으면 다음 편성 예약
+ */
+void GameEventHandler::handle_matchmake(const Event& ev)
+{
+    auto groups = game_manager_.form_matches();
+    for (auto& group : groups) {
+        try {
+            create_room(group.players);
+        } catch (const std::exception& e) {
+            // 방을 만들지 못한 묶음은 잃어버리지 않도록 원래 등록 시각으로 대기열에 되돌림
+            // (대기 순서 / max_wait 경과 유지, 접속이 끊긴 플레이어 제외)
+            LOG_ERROR("[GameEventHandler] create_room failed: " << e.what()
+                      << " - requeue " << group.players.size() << " players");
+            for (std::size_t i = 0; i < group.players.size(); ++i) {
+                auto& p = group.players[i];
+                if (auto conn = p->get_connection()) {
+                    auto rtt = conn->rtt();
+                    game_manager_.add_waiting_player(p, rtt.has_sample() ? static_cast<int>(rtt.srtt_ms()) : 0,
+                                                     group.enqueued_at[i]);
+                }
+            }
+        }
+    }
+
+    int interval_ms = game_manager_.config().matchmaking_interval_ms;
+    if (static_cast<GameSubType>(ev.sub_type) == GameSubType::MATCHMAKE && interval_ms > 0) {
+        schedule_matchmake(interval_ms);
     }
 }
 
 /** 
- * ROOM_CREATE:
- * - 대기열(5명) pop 해서 방 만들고
+ * 방 생성:
+ * - 편성된 플레이어로 방 만들고
  * - 방에 플레이어 추가 + broadcast("go to waiting screen")
  * - 다음 이벤트로 "GAME_START_COUNTDOWN" enqueue
+ * - 플레이어 입장까지 실패하면 반쯤 만든 방을 제거하고 플레이어 방 상태를 되돌린 뒤 예외 전달
  */
-void GameEventHandler::handle_room_create(const Event& ev)
+void GameEventHandler::create_room(const std::vector<std::shared_ptr<Player>>& players)
 {
-    // 1) 5명 pop
-    auto players = game_manager_.pop_waiting_players(5);
+    // 1) 편성된 플레이어
     if (players.empty()) {
-        std::cout << "[GameEventHandler] handle_room_create but no players.\n";
+        LOG_WARN("[GameEventHandler] create_room but no players.");
         return;
     }
 
-    // 2) room_id
-    int rid = game_manager_.current_room_id++;
-    auto room = game_manager_.create_room(rid);
-
-    // 3) 맵 초기화
-    room->initialize_maps();
-
-    // 4) 플레이어 add (자동으로 첫 맵(A) 등에 배정)
-    for (auto& p : players) {
-        // 새 구조: Room::join_player() 이용
-        room->join_player(p); 
+    std::shared_ptr<Room> room;
+    try {
+        // 2) room_id (방 슬롯 핸들 값)
+        //    - 플레이어 입장 전까지 미공개 → 방 정리가 빈 방으로 보고 먼저 제거하지 않음
+        room = game_manager_.reserve_room();
+        // 시뮬레이션 모드가 켜져 있으면 틱 모드는 사용하지 않음 (스텝이 스냅샷까지 담당)
+        room->set_simulation_step_ms(game_manager_.config().simulation_step_ms);
+        room->set_tick_interval_ms(room->is_simulation_mode() ? 0 : game_manager_.config().tick_interval_ms);
+
+        // 3) 맵 초기화
+        room->initialize_maps(game_manager_.config().map_seed);
+        room->set_view_radius(game_manager_.config().view_radius);
+        room->set_terrain_chunk_size(game_manager_.config().terrain_chunk_size);
+
+        // 4) 플레이어 add (자동으로 첫 맵(A) 등에 배정)
+        for (auto& p : players) {
+            // 새 구조: Room::join_player() 이용
+            room->join_player(p); 
+            // 시뮬레이션 모드: 이동 입력은 이벤트 없이 버퍼링 → 스텝에서 소비
+            p->move_slot_.set_buffer_only(room->is_simulation_mode());
+        }
+        game_manager_.publish_room(room);
+    } catch (...) {
+        if (room) {
+            for (auto& p : players) {
+                room->remove_player(p);
+            }
+            game_manager_.remove_room(room->id_);
+        }
+        for (auto& p : players) {
+            p->reset_room();
+        }
+        throw;
     }
+    uint64_t rid = room->id_;
+    SERVER_PROBE2(room_create, rid, players.size());
+    bool terrain_streaming = game_manager_.config().terrain_chunk_size > 0;
 
     // 5) Room 전체 정보 브로드캐스팅팅 (대기화면 이동 명령)
+    //    - 지형 스트리밍: 장애물 없이 전송 후, 시작 위치 주변 청크만 개별 전송
+    OutputBatch out;
     {
-        nlohmann::json broadcast_msg = room->extract_all_map_info();
+        nlohmann::json broadcast_msg = room->extract_all_map_info(!terrain_streaming);
         broadcast_msg["action"] = "room_create";
         broadcast_msg["result"] = true;
         std::string body = broadcast_msg.dump();
         auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::ROOM_CREATE, body);
-        room->broadcast_message(resp);
+        out.send_to_room(*room, resp);
     }
+    if (terrain_streaming) {
+        for (auto& p : players) {
+            if (auto start_map = p->current_map()) {
+                stream_terrain(room, start_map, p, {start_map->start_point}, out);
+            }
+        }
+    }
+    out.flush();
 
     // 6) 다음 이벤트: GAME_COUNTDOWN
     Event countEv;
@@ -104,7 +232,7 @@ void GameEventHandler::handle_game_countdown(const Event& ev)
 {
     auto room = game_manager_.find_room(ev.room_id);
     if (!room) {
-        std::cerr << "[GameEventHandler] handle_game_start_countdown: no room found.\n";
+        LOG_WARN("[GameEventHandler] handle_game_start_countdown: no room found.");
         return;
     }
 
@@ -135,22 +263,14 @@ void GameEventHandler::handle_game_countdown(const Event& ev)
         return;
     }
 
-    // 4) 1초 후, 남은초-1 로 재귀 이벤트
-    auto timer = std::make_shared<boost::asio::steady_timer>(ioc_);
-    timer->expires_after(std::chrono::seconds(1));
-    timer->async_wait([this, timer, room_id=ev.room_id, remaining](auto ec){
-        if(!ec) {
-            // 남은초 -1
-            int nextSec = remaining - 1;
-            Event next;
-            next.main_type = MainEventType::GAME;
-            next.sub_type  = (uint16_t)GameSubType::GAME_COUNTDOWN;
-            next.room_id   = room_id;
-            auto s = std::to_string(nextSec);
-            next.data.assign(s.begin(), s.end());
-            Reactor::get_instance().enqueue_event(next);
-        }
-    });
+    // 4) 1초 후, 남은초-1 로 재귀 이벤트 (타이머 휠, 같은 틱의 방 타이머와 묶어서 처리)
+    Event next;
+    next.main_type = MainEventType::GAME;
+    next.sub_type  = (uint16_t)GameSubType::GAME_COUNTDOWN;
+    next.room_id   = ev.room_id;
+    auto s = std::to_string(remaining - 1);
+    next.data.assign(s.begin(), s.end());
+    TimerService::get_instance().schedule_event_after(std::chrono::seconds(1), std::move(next));
 }
 
 /** 
@@ -163,7 +283,7 @@ void GameEventHandler::handle_game_start(const Event& ev)
 {
     auto room = game_manager_.find_room(ev.room_id);
     if(!room) {
-        std::cerr << "[GameEventHandler] handle_game_start: no room.\n";
+        LOG_WARN("[GameEventHandler] handle_game_start: no room.");
         return;
     }
 
@@ -180,38 +300,119 @@ void GameEventHandler::handle_game_start(const Event& ev)
         auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::GAME_START, body);
         room->broadcast_message(resp);
     }
+
+    // 시뮬레이션 모드: 첫 스텝 예약 / 틱 모드: 첫 GAME_TICK 예약
+    if (room->is_simulation_mode()) {
+        schedule_simulation_step(ev.room_id, room->simulation_step_ms());
+    } else if (room->is_tick_mode()) {
+        schedule_game_tick(ev.room_id, room->tick_interval_ms());
+    }
 }
 
 /**
  * PLAYER_MOVED:
- * - ev.data: JSON {"x":..., "y":...}
- * - 1) 플레이어 위치 검증(맵 범위, 이동 범위, 벽 등)
- * - 2) 이동
- * - 3) 같은 맵 플레이어에게만 이동 정보 브로드캐스트
- * - 4) 도착 확인
+ * - 이동 입력은 Reactor 에서 플레이어 입력 슬롯(move_slot_)에 원본 그대로 병합됨
+ *   (플레이어당 처리 대기 이벤트는 최대 1개)
+ * - player / room 은 handle_event 에서 한 번만 찾은 것 (ConnectionManager / 방 목록 재조회 없음)
+ * - 슬롯에 쌓인 경로를 모두 처리할 때까지 반복 (파싱/예산 확인은 여기서)
  */
-void GameEventHandler::handle_player_moved(const Event& ev)
+void GameEventHandler::handle_player_moved(const std::shared_ptr<Player>& player, const std::shared_ptr<Room>& room)
 {
-    auto player = ConnectionManager::get_instance().get_player_for_connection(ev.connection->lock());
     if(!player) {
-        std::cerr << "[GameEventHandler] handle_player_moved: no player.\n";
+        LOG_WARN("[GameEventHandler] handle_player_moved: no player.");
         return;
     }
 
-    auto room = game_manager_.find_room(player->room_id_);
+    std::vector<RawMoveInput> raw;
     if(!room) {
-        std::cerr << "[GameEventHandler] handle_player_moved: no romm.\n";
+        // 방을 떠났거나 게임이 끝남 → 쌓인 입력은 버리고 슬롯을 비움
+        LOG_WARN("[GameEventHandler] handle_player_moved: no room.");
+        while (player->move_slot_.take(raw)) {}
         return;
     }
 
-    // parse pos
-    std::string str(ev.data.begin(), ev.data.end());
-    auto parsed = nlohmann::json::parse(str);
-    int nx = parsed["x"].get<int>();
-    int ny = parsed["y"].get<int>();
+    // 시뮬레이션 모드: 입력은 방 스텝에서 처리
+    if (room->is_simulation_mode()) {
+        return;
+    }
+
+    std::vector<MoveInput> path;
+    bool processed = false;
+    OutputBatch out;
+    while (player->move_slot_.take(raw)) {
+        parse_move_inputs(room, raw, path);
+        if (!path.empty()) {
+            apply_player_moves(room, player, path, out);
+            processed = true;
+        }
+    }
+    out.flush();
+
+    if (!processed) {
+        LOG_WARN("[GameEventHandler] handle_player_moved: no valid move input.");
+    }
+}
+
+/**
+ * 원본 이동 입력 → 경로
+ * - 방이 자원 예산을 넘긴 동안은 입력을 버림 (한 방의 입력 폭주가 공용 스레드풀을 점유하지 않도록)
+ * - 파싱 실패 입력은 버림
+ */
+void GameEventHandler::parse_move_inputs(const std::shared_ptr<Room>& room, const std::vector<RawMoveInput>& raw,
+                                         std::vector<MoveInput>& path)
+{
+    path.clear();
+    path.reserve(raw.size());
+    for (const auto& data : raw) {
+        if (room) {
+            bool was_throttled = room->usage().throttled();
+            if (!room->usage().admit_input(data.size())) {
+                if (!was_throttled) {
+                    LOG_WARN("[GameEventHandler] room " << room->id_ << " over budget, dropping move inputs");
+                }
+                throttled_inputs_counter().inc();
+                continue;
+            }
+        }
+
+        try {
+            auto parsed = nlohmann::json::parse(data);
+            MoveInput input;
+            input.position = {parsed["x"].get<int>(), parsed["y"].get<int>()};
+            input.seq = parsed.value("seq", 0u);
+            path.push_back(input);
+        } catch (const std::exception& e) {
+            LOG_WARN("[GameEventHandler] invalid move input: " << e.what());
+        }
+    }
+}
+
+/**
+ * 이동 경로 적용:
+ * - path: 입력 순서대로 쌓인 이동 위치 (각각 JSON {"x":..., "y":..., "seq":...} 로 수신)
+ * - 1) 플레이어 위치 검증(맵 범위, 이동 범위, 벽 등) - 경로의 각 칸마다 수행
+ * - 2) 이동 (잘못된 칸을 만나면 이후 입력은 버리고 보정 위치 전송)
+ * - 3) 같은 맵 플레이어에게 최종 위치만 한 번 브로드캐스트
+ * - 4) 도착 / 포탈 확인 (도달하면 이후 입력은 버리고, 버린 입력이 있으면 보정 위치 전송)
+ *
+ * 시퀀스(seq)를 보내는 클라이언트(클라이언트 측 예측):
+ * - 본인에게는 이동 에코를 보내지 않고, 마지막 적용 seq 만 ack
+ *   (틱 모드: 스냅샷의 본인 항목 seq / 즉시 모드: 처리 묶음당 seq 만 담은 move_ack 1개,
+ *    본인에게 가는 다른 통지와 같은 쓰기로 나감)
+ * - 거절 시에만 보정 위치 + 거절된 seq 전송
+ *
+ * 모든 통지(보정, 이동, 시야, 지형, 도착, 맵 이동)는 out 에 모으고, 호출자가 묶음 끝에 한 번 전송
+ */
+void GameEventHandler::apply_player_moves(const std::shared_ptr<Room>& room, std::shared_ptr<Player> player,
+                                          const std::vector<MoveInput>& path, OutputBatch& out)
+{
+    // 방을 떠났거나 이미 도착한 플레이어의 입력은 무시
+    if (!room->is_player_active(*player) || room->is_player_finished(*player)) {
+        return;
+    }
 
     // 현재 맵
-    auto cur_map = player->current_map_.lock();
+    auto cur_map = player->current_map();
     if(!cur_map) {
         // 플레이어가 맵이 없다고? 이상 상황
         nlohmann::json broadcast_msg {
@@ -221,58 +422,130 @@ void GameEventHandler::handle_player_moved(const Event& ev)
         };
         std::string body = broadcast_msg.dump();
         auto resp = Utils::create_response_string(MainEventType::ERROR, (uint16_t)ErrorSubType::UNKNOWN, body);
-        player->send_message(resp);
+        out.send(player, resp);
         return;
     }
 
-    // 1) 위치 검증: 범위 / 벽(추후) 
-    Point newPos{nx, ny};
-    if(!cur_map->is_valid_position(newPos) || !player->is_valid_position(newPos)) {
-        // 응답: invalid pos
+    // 1) 위치 검증 + 2) 이동: 경로를 한 칸씩 순서대로
+    //    (위치/seq 는 방 상태가 원본 → 묶음 처리 후 한 번에 반영)
+    const Point old_pos = room->player_position(*player);
+    Point newPos = old_pos;
+    uint32_t last_seq = room->player_seq(*player);
+    int steps = 0;
+    bool rejected = false;
+    bool predicted = false;   // 시퀀스를 보낸 클라이언트인지
+    uint32_t rejected_seq = 0;
+    std::vector<Point> visited; // 적용된 위치 (지형 스트리밍용)
+    for (std::size_t i = 0; i < path.size(); ++i) {
+        const MoveInput& input = path[i];
+        predicted = predicted || input.seq > 0;
+        if(!cur_map->is_valid_position(input.position) || !Player::is_valid_step(newPos, input.position)) {
+            rejected = true;
+            rejected_seq = input.seq;
+            break;
+        }
+        newPos = input.position;
+        visited.push_back(newPos);
+        if (input.seq > 0) {
+            last_seq = input.seq;
+        }
+        steps++;
+
+        // 도착 / 포탈에 닿으면 이후 입력은 이전 맵 기준이므로 버림
+        // → 클라이언트가 예측 이동을 되돌리도록 거절과 같은 보정 전송
+        if ((cur_map->is_end_map() && cur_map->is_end_position(newPos)) || cur_map->is_portal(newPos)) {
+            if (i + 1 < path.size()) {
+                rejected = true;
+                rejected_seq = path[i + 1].seq;
+                predicted = predicted || rejected_seq > 0;
+            }
+            break;
+        }
+    }
+
+    if (rejected) {
+        // 응답: invalid pos (적용된 위치까지 보정)
         nlohmann::json broadcast_msg {
             {"action", "player_moved"},
             {"result", false},
             {"player_id", player->id_},
-            {"x", player->position_.x},
-            {"y", player->position_.y},
+            {"x", newPos.x},
+            {"y", newPos.y},
             {"map", cur_map->name}
         };
+        if (predicted) {
+            broadcast_msg["seq"] = last_seq;
+            broadcast_msg["rejected_seq"] = rejected_seq;
+        }
         std::string body = broadcast_msg.dump();
         auto resp = Utils::create_response_string(MainEventType::ERROR, (uint16_t)ErrorSubType::UNKNOWN, body);
-        player->send_message(resp);
-        return;
+        out.send(player, resp);
     }
 
-    // 2) 이동
-    player->update_position(newPos);
+    if (steps == 0) {
+        return;
+    }
 
     // 3) 해당 맵 broadcast
-    {
+    //    - 관심 영역: 이전/이후 위치를 시야에 둔 플레이어에게만 + 시야 진입/이탈 통지
+    //    - 틱 모드: 변경 기록만 남기고, 다음 틱 스냅샷으로 전송 (seq ack 포함)
+    room->record_player_move(*player, *cur_map, newPos, steps, last_seq, room->uses_snapshots());
+
+    InterestChange interest;
+    if (cur_map->has_interest_management()) {
+        interest = cur_map->update_player_interest(player, old_pos, newPos);
+        send_interest_changes(room, cur_map, player, interest, out);
+    }
+
+    if (!room->uses_snapshots()) {
         nlohmann::json broadcast_msg {
             {"action", "player_moved"},
             {"result", true},
             {"player_id", player->id_},
-            {"x", nx},
-            {"y", ny},
+            {"x", newPos.x},
+            {"y", newPos.y},
             {"map", cur_map->name}
         };
         std::string body = broadcast_msg.dump();
         auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_MOVED, body);
-        cur_map->broadcast_in_map(resp);
+
+        // 예측하는 본인은 에코에서 제외 (seq 없는 클라이언트는 에코로 이동 확인)
+        if (cur_map->has_interest_management()) {
+            for (auto& observer : interest.moved) {
+                out.send(observer, resp);
+            }
+            if (!predicted) {
+                out.send(player, resp);
+            }
+        } else {
+            out.send_to_map(*cur_map, resp, predicted ? player : nullptr);
+        }
+
+        if (predicted) {
+            // { "action": "move_ack", "seq": 17 }
+            nlohmann::json ack_msg {
+                {"action", "move_ack"},
+                {"seq", last_seq}
+            };
+            auto ack = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_MOVED, ack_msg.dump());
+            out.send(player, ack);
+        }
     }
 
+    // 지형 스트리밍: 지나온 위치 주변의 새 청크 전송
+    stream_terrain(room, cur_map, player, visited, out);
+
     // 4) 도착인지 체크 (end_point)
     //    - 마지막 맵인 경우, end_point={299,299} etc.
-    //    TODO: 모든 플레이어 도착 시, 게임 종료.
     if(cur_map->is_end_map() // 마지막 맵
        && cur_map->is_end_position(newPos))
     {
         // 플레이어가 도착 => 게임 종료(또는 별도 rank)
         // remove from map, broadcast "finished"
-        player->is_finished_ = true;
+        room->record_player_finished(*player);
 
         // 플레이어 기록 등록
-        room->gr_.add_player_result(player);
+        room->gr_.add_player_result(player, room->player_distance(*player));
 
         // 현재까지의 게임 결과 가져오기
         nlohmann::json broadcast_msg = room->gr_.to_json();
@@ -282,7 +555,7 @@ void GameEventHandler::handle_player_moved(const Event& ev)
         broadcast_msg["player_name"] = player->name_;
         std::string body = broadcast_msg.dump();
         auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_FINISHED, body);
-        room->broadcast_message(resp);
+        out.send_to_room(*room, resp);
 
         // old map remove
         bool removed = cur_map->remove_player(player);
@@ -295,16 +568,12 @@ void GameEventHandler::handle_player_moved(const Event& ev)
             };
             std::string body = broadcast_msg.dump();
             auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_COME_OUT_MAP, body);
-            cur_map->broadcast_in_map(resp);
+            out.send_to_observers(*cur_map, newPos, resp);
         }
 
-        // 모든 플레이어 도착 시, 게임 종료 이벤트
-        if (room->is_all_players_finished()) {
-            Event endEv;
-            endEv.main_type = MainEventType::GAME;
-            endEv.sub_type  = (uint16_t)GameSubType::GAME_END;
-            endEv.room_id   = ev.room_id;
-            Reactor::get_instance().enqueue_event(endEv);
+        // 모든 플레이어 도착 시, 게임 종료 이벤트 (시뮬레이션 모드는 스텝 끝에서 확인)
+        if (!room->is_simulation_mode() && room->is_all_players_finished()) {
+            request_game_end(room, "finished");
         }
         
         return;
@@ -324,13 +593,13 @@ void GameEventHandler::handle_player_moved(const Event& ev)
             };
             std::string body = broadcast_msg.dump();
             auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_COME_OUT_MAP, body);
-            cur_map->broadcast_in_map(resp);
+            out.send_to_observers(*cur_map, newPos, resp);
         }
 
         // 포탈의 linked_map_name 찾기
         std::string linked_map="";
         for(auto& pt : cur_map->portals_) {
-            if(pt.position == player->position_) {
+            if(pt.position == newPos) {
                 linked_map = pt.linked_map_name;
                 break;
             }
@@ -338,10 +607,10 @@ void GameEventHandler::handle_player_moved(const Event& ev)
         if(!linked_map.empty()) {
             auto new_map = room->get_map_by_name(linked_map);
             if(new_map) {
-                new_map->add_player(player);
-                player->current_map_ = new_map;
-                // 새 맵의 start_point로 위치를 업데이트
-                player->update_position(new_map->start_point);
+                // 새 맵의 start_point로 위치를 업데이트 (포탈 이동도 한 칸으로 계산)
+                new_map->add_player(player, new_map->start_point);
+                player->set_current_map(new_map);
+                room->record_player_move(*player, *new_map, new_map->start_point, 1, 0, false);
 
                 // broadcast
                 nlohmann::json broadcast_msg {
@@ -349,17 +618,40 @@ void GameEventHandler::handle_player_moved(const Event& ev)
                     {"result", true},
                     {"player_id",player->id_},
                     {"map", new_map->name},
-                    {"x", player->position_.x},
-                    {"y", player->position_.y}
+                    {"x", new_map->start_point.x},
+                    {"y", new_map->start_point.y}
                 };
-                broadcast_msg["players"] = new_map->extract_players_position_info();
-                auto body = broadcast_msg.dump();
-                auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_COME_IN_MAP, body);
-                new_map->broadcast_in_map(resp);
+                if (new_map->has_interest_management()) {
+                    // 관심 영역: 시작 위치를 시야에 둔 플레이어에게만 알리고,
+                    // 들어온 본인에게는 시야 안의 플레이어 위치만 전송
+                    auto observers = new_map->get_observers(new_map->start_point);
+                    nlohmann::json visible = nlohmann::json::array();
+                    for (auto& p : observers) {
+                        visible.push_back(room->player_position_info(*p));
+                    }
+
+                    broadcast_msg["players"] = nlohmann::json::array({ room->player_position_info(*player) });
+                    auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_COME_IN_MAP, broadcast_msg.dump());
+                    for (auto& p : observers) {
+                        if (p == player) continue;
+                        out.send(p, resp);
+                    }
+
+                    broadcast_msg["players"] = std::move(visible);
+                    out.send(player, Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_COME_IN_MAP, broadcast_msg.dump()));
+                } else {
+                    broadcast_msg["players"] = room->players_position_info(*new_map);
+                    auto body = broadcast_msg.dump();
+                    auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_COME_IN_MAP, body);
+                    out.send_to_map(*new_map, resp);
+                }
+
+                // 지형 스트리밍: 새 맵 시작 위치 주변 청크
+                stream_terrain(room, new_map, player, {new_map->start_point}, out);
             } else {
                 // rollback?
-                cur_map->add_player(player);
-                player->current_map_ = cur_map;
+                cur_map->add_player(player, newPos);
+                player->set_current_map(cur_map);
 
                 //broadcast
                 nlohmann::json broadcast_msg {
@@ -369,37 +661,53 @@ void GameEventHandler::handle_player_moved(const Event& ev)
                 };
                 std::string body = broadcast_msg.dump();
                 auto resp = Utils::create_response_string(MainEventType::ERROR, (uint16_t)ErrorSubType::UNKNOWN, body);
-                player->send_message(resp);
+                out.send(player, resp);
             }
         }
     }
 }
 
+void GameEventHandler::request_game_end(const std::shared_ptr<Room>& room, const std::string& reason)
+{
+    if (!room->mark_ending()) {
+        return; // 이미 요청됨
+    }
+    Event endEv;
+    endEv.main_type = MainEventType::GAME;
+    endEv.sub_type  = (uint16_t)GameSubType::GAME_END;
+    endEv.room_id   = room->id_;
+    endEv.data.assign(reason.begin(), reason.end());
+    Reactor::get_instance().enqueue_event(endEv);
+}
+
 /** 
  * GAME_END:
  * - 게임 종료
  * - 게임 종료 및 게임 이력 저장 등등
  * - 플레이어-커넥션 관계 제거
+ * { "action": "game_end", "result": true, "reason": "finished" }
  */
 void GameEventHandler::handle_game_end(const Event& ev)
 {
     auto room = game_manager_.find_room(ev.room_id);
     if(!room) {
-        std::cerr << "[GameEventHandler] handle_game_end: no room.\n";
+        LOG_WARN("[GameEventHandler] handle_game_end: no room.");
         return;
     }
 
     // 게임 종료 시간 기록
-    room->gr_.set_game_start_time();
+    room->gr_.set_game_end_time();
 
     // TODO: save game data
 
 
     // end broadcast
     {
+        std::string reason(ev.data.begin(), ev.data.end());
         nlohmann::json broadcast_msg {
             {"action", "game_end"},
-            {"result", true}
+            {"result", true},
+            {"reason", reason.empty() ? "finished" : reason}
         };
         std::string body = broadcast_msg.dump();
         auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::GAME_END, body);
@@ -419,3 +727,287 @@ void GameEventHandler::handle_game_end(const Event& ev)
     // Room remove
     game_manager_.remove_room(ev.room_id);
 }
+
+/**
+ * GAME_TICK (틱 모드 전용):
+ * - 맵마다 마지막 틱 이후 위치가 바뀐 플레이어만 모아 하나의 스냅샷으로 전송 (send_snapshots)
+ * - 방이 남아있으면 다음 틱 예약 (GAME_END 로 방이 제거되면 자연히 멈춤)
+ * {
+ *   "action": "snapshot",
+ *   "tick": 12,
+ *   "map": "A",
+ *   "players": [ {"player_id": "...", "x": 3, "y": 4}, ... ]
+ * }
+ */
+void GameEventHandler::handle_game_tick(const Event& ev)
+{
+    auto room = game_manager_.find_room(ev.room_id);
+    if (!room) {
+        // 게임 종료 후 남은 틱 => 무시
+        return;
+    }
+
+    OutputBatch out;
+    send_snapshots(room, out);
+    out.flush();
+
+    schedule_game_tick(ev.room_id, room->tick_interval_ms());
+}
+
+/**
+ * SIMULATION_STEP (시뮬레이션 모드 전용):
+ * - 방 플레이어마다 버퍼링된 입력을 입장 순서대로 꺼내 적용 (검증/도착/포탈 처리 포함)
+ * - 이동 결과는 스텝 끝에 맵별 스냅샷으로 한 번에 전송
+ * - 스텝 중 생긴 다른 통지(보정, 시야, 지형, 도착, 맵 이동)도 스냅샷과 함께 모아 스텝 끝에 수신자당 한 번 전송
+ * - 모든 플레이어가 도착했으면 GAME_END, 아니면 다음 스텝 예약
+ */
+void GameEventHandler::handle_simulation_step(const Event& ev)
+{
+    auto room = game_manager_.find_room(ev.room_id);
+    if (!room) {
+        // 게임 종료 후 남은 스텝 => 무시
+        return;
+    }
+
+    std::vector<RawMoveInput> raw;
+    std::vector<MoveInput> path;
+    OutputBatch out;
+    for (auto& player : room->get_all_players()) {
+        if (player->move_slot_.take(raw)) {
+            parse_move_inputs(room, raw, path);
+            if (!path.empty()) {
+                apply_player_moves(room, player, path, out);
+            }
+        }
+    }
+
+    send_snapshots(room, out);
+    out.flush();
+
+    if (room->is_all_players_finished()) {
+        request_game_end(room, "finished");
+        return;
+    }
+
+    schedule_simulation_step(ev.room_id, room->simulation_step_ms());
+}
+
+/**
+ * ROOM_REAP (방 수명 관리):
+ * - 한 번에 room_reap_batch 개 방만 점검 (커서로 이어서 순회)
+ * - 남은 플레이어가 없는 방: 바로 제거 (알릴 대상 없음)
+ * - 최대 게임 시간을 넘긴 방: GAME_END("timeout")
+ */
+void GameEventHandler::handle_room_reap(const Event&)
+{
+    const auto& config = game_manager_.config();
+    auto now = std::chrono::steady_clock::now();
+    auto max_duration = std::chrono::milliseconds(config.max_game_duration_ms);
+
+    for (auto& room : game_manager_.next_rooms_to_check(static_cast<std::size_t>(std::max(config.room_reap_batch, 1)))) {
+        if (room->present_count() == 0) {
+            LOG_INFO("[GameEventHandler] reap empty room " << room->id_);
+            game_manager_.remove_room(room->id_);
+        } else if (config.max_game_duration_ms > 0 && now - room->created_at_ >= max_duration) {
+            request_game_end(room, "timeout");
+        }
+    }
+
+    if (config.room_reap_interval_ms > 0) {
+        schedule_room_reap(config.room_reap_interval_ms);
+    }
+}
+
+/**
+ * 맵별 변경분 스냅샷 전송 (틱 / 시뮬레이션 스텝 공용)
+ * - 변경이 없는 맵은 전송하지 않음
+ */
+void GameEventHandler::send_snapshots(const std::shared_ptr<Room>& room, OutputBatch& out)
+{
+    uint64_t tick = room->next_tick();
+    for (auto& m : room->get_maps()) {
+        auto dirty = room->take_dirty_snapshot(*m);
+        if (dirty.empty()) {
+            continue;
+        }
+
+        auto make_snapshot = [&](const nlohmann::json& players) {
+            nlohmann::json broadcast_msg {
+                {"action", "snapshot"},
+                {"result", true},
+                {"tick", tick},
+                {"map", m->name},
+                {"players", players}
+            };
+            std::string body = broadcast_msg.dump();
+            return Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::GAME_TICK, body);
+        };
+
+        if (!m->has_interest_management()) {
+            nlohmann::json players = nlohmann::json::array();
+            for (auto& snap : dirty) {
+                players.push_back(std::move(snap.info));
+            }
+            out.send_to_map(*m, make_snapshot(players));
+            continue;
+        }
+
+        // 관심 영역: 관찰자마다 시야 안의 변경분만 모아서 전송
+        std::unordered_map<std::shared_ptr<Player>, nlohmann::json> per_observer;
+        for (auto& snap : dirty) {
+            for (auto& observer : m->get_observers(snap.position)) {
+                auto& players = per_observer[observer];
+                if (players.is_null()) {
+                    players = nlohmann::json::array();
+                }
+                players.push_back(snap.info);
+            }
+        }
+        for (auto& [observer, players] : per_observer) {
+            out.send(observer, make_snapshot(players));
+        }
+    }
+}
+
+/**
+ * 관심 영역: 시야 진입/이탈 통지
+ * - 관찰자: 이동한 플레이어의 진입/이탈을 각각 통지
+ * - 이동한 본인: 새로 보이게 된 / 안 보이게 된 플레이어 목록을 한 번에 통지
+ * {
+ *   "action": "player_enter_view", "map": "A",
+ *   "players": [ {"player_id": "...", "x": 3, "y": 4}, ... ]
+ * }
+ * {
+ *   "action": "player_leave_view", "map": "A",
+ *   "player_ids": [ "...", ... ]
+ * }
+ */
+void GameEventHandler::send_interest_changes(const std::shared_ptr<Room>& room,
+                                             const std::shared_ptr<Map>& map,
+                                             const std::shared_ptr<Player>& player,
+                                             const InterestChange& change,
+                                             OutputBatch& out)
+{
+    auto make_enter = [&](const nlohmann::json& players) {
+        nlohmann::json msg {
+            {"action", "player_enter_view"},
+            {"result", true},
+            {"map", map->name},
+            {"players", players}
+        };
+        return Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_ENTER_VIEW, msg.dump());
+    };
+    auto make_leave = [&](const nlohmann::json& player_ids) {
+        nlohmann::json msg {
+            {"action", "player_leave_view"},
+            {"result", true},
+            {"map", map->name},
+            {"player_ids", player_ids}
+        };
+        return Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_LEAVE_VIEW, msg.dump());
+    };
+
+    if (!change.entered.empty()) {
+        auto resp = make_enter(nlohmann::json::array({room->player_position_info(*player)}));
+        nlohmann::json visible = nlohmann::json::array();
+        for (auto& other : change.entered) {
+            out.send(other, resp);
+            visible.push_back(room->player_position_info(*other));
+        }
+        out.send(player, make_enter(visible));
+    }
+
+    if (!change.left.empty()) {
+        auto resp = make_leave(nlohmann::json::array({player->id_}));
+        nlohmann::json hidden = nlohmann::json::array();
+        for (auto& other : change.left) {
+            out.send(other, resp);
+            hidden.push_back(other->id_);
+        }
+        out.send(player, make_leave(hidden));
+    }
+}
+
+/**
+ * 지형 스트리밍:
+ * - positions 각각의 주변(3x3) 청크 중 해당 플레이어에게 아직 보내지 않은 청크만 전송
+ * - 청크는 플레이어당 최대 1회 전송 (방 상태에 맵별로 기록, 상태 잠금 하에서 확인/표시)
+ * - 한 번의 호출에서 새 청크들을 하나의 메시지로 묶어 전송
+ * {
+ *   "action": "terrain_chunk",
+ *   "map": "A",
+ *   "chunks": [ {"chunk": 0, "x": 0, "y": 0, "width": 8, "height": 8, "obstacles": [...]}, ... ]
+ * }
+ */
+void GameEventHandler::stream_terrain(const std::shared_ptr<Room>& room,
+                                      const std::shared_ptr<Map>& map,
+                                      const std::shared_ptr<Player>& player,
+                                      const std::vector<Point>& positions,
+                                      OutputBatch& out)
+{
+    if (!map->is_terrain_streaming()) {
+        return;
+    }
+
+    std::vector<int> around;
+    for (const auto& pos : positions) {
+        auto ids = map->get_chunks_around(pos);
+        around.insert(around.end(), ids.begin(), ids.end());
+    }
+    auto unsent = room->take_unsent_chunks(*player, *map, around);
+    if (unsent.empty()) {
+        return;
+    }
+
+    nlohmann::json chunks = nlohmann::json::array();
+    for (int chunk : unsent) {
+        chunks.push_back(map->extract_chunk_info(chunk));
+    }
+
+    nlohmann::json msg {
+        {"action", "terrain_chunk"},
+        {"result", true},
+        {"map", map->name},
+        {"chunks", chunks}
+    };
+    auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::TERRAIN_CHUNK, msg.dump());
+    out.send(player, resp);
+}
+
+void GameEventHandler::schedule_matchmake(int interval_ms)
+{
+    TimerService::get_instance().schedule_after(std::chrono::milliseconds(interval_ms), [](){
+        Event next;
+        next.main_type = MainEventType::GAME;
+        next.sub_type  = (uint16_t)GameSubType::MATCHMAKE;
+        Reactor::get_instance().enqueue_event(next);
+    });
+}
+
+void GameEventHandler::schedule_game_tick(uint64_t room_id, int interval_ms)
+{
+    Event next;
+    next.main_type = MainEventType::GAME;
+    next.sub_type  = (uint16_t)GameSubType::GAME_TICK;
+    next.room_id   = room_id;
+    TimerService::get_instance().schedule_event_after(std::chrono::milliseconds(interval_ms), std::move(next));
+}
+
+void GameEventHandler::schedule_room_reap(int interval_ms)
+{
+    TimerService::get_instance().schedule_after(std::chrono::milliseconds(interval_ms), [](){
+        Event next;
+        next.main_type = MainEventType::GAME;
+        next.sub_type  = (uint16_t)GameSubType::ROOM_REAP;
+        Reactor::get_instance().enqueue_event(next);
+    });
+}
+
+void GameEventHandler::schedule_simulation_step(uint64_t room_id, int step_ms)
+{
+    Event next;
+    next.main_type = MainEventType::GAME;
+    next.sub_type  = (uint16_t)GameSubType::SIMULATION_STEP;
+    next.room_id   = room_id;
+    TimerService::get_instance().schedule_event_after(std::chrono::milliseconds(step_ms), std::move(next));
+}
@@ -3,11 +3,12 @@
 
 #include "event.hpp"
 #include "game_manager.hpp"
+#include "output_batch.hpp"
 
 /**
  * GameEventHandler
  * - GAME 타입 이벤트를 처리하는 클래스
- * - 방 생성, 카운트다운, 게임 시작, 플레이어 이동 등을 담당
+ * - 매치메이킹/방 생성, 카운트다운, 게임 시작, 플레이어 이동, 틱 스냅샷 등을 담당
  */
 class GameEventHandler {
 public:
@@ -17,16 +18,69 @@ public:
     // 이벤트 처리 함수
     void handle_event(const Event& event);
 
+    // GAME_END 요청 (방마다 한 번만 enqueue)
+    // reason: "finished" / "timeout" / "abandoned" 등 (game_end 메시지에 포함)
+    static void request_game_end(const std::shared_ptr<Room>& room, const std::string& reason);
+
 private:
     GameManager& game_manager_;
     boost::asio::io_context& ioc_;
 
+    // PLAYER_MOVED 를 보낸 플레이어 (커넥션에 캐시된 플레이어, 없으면 nullptr)
+    static std::shared_ptr<Player> player_for_event(const Event& ev);
+
+    // 이벤트가 속한 방 (player 가 있으면 그 플레이어의 방, 아니면 room_id 의 방, 없으면 nullptr)
+    std::shared_ptr<Room> room_for_event(const Event& ev, const std::shared_ptr<Player>& player);
+
     // 서브 핸들러들
-    void handle_room_create(const Event& ev);
+    void handle_matchmake(const Event& ev);
     void handle_game_countdown(const Event& ev);
     void handle_game_start(const Event& ev);
-    void handle_player_moved(const Event& ev);
+    void handle_player_moved(const std::shared_ptr<Player>& player, const std::shared_ptr<Room>& room);
     void handle_game_end(const Event& ev);
+    void handle_game_tick(const Event& ev);
+    void handle_simulation_step(const Event& ev);
+    void handle_room_reap(const Event& ev);
+
+    // 편성된 플레이어로 방 생성 + 카운트다운 시작
+    void create_room(const std::vector<std::shared_ptr<Player>>& players);
+
+    // 매치메이킹: interval 후 다음 MATCHMAKE 이벤트 예약
+    void schedule_matchmake(int interval_ms);
+
+    // 슬롯에서 꺼낸 원본 입력 파싱 + 방 입력 예산 확인 (워커에서)
+    void parse_move_inputs(const std::shared_ptr<Room>& room, const std::vector<RawMoveInput>& raw,
+                           std::vector<MoveInput>& path);
+
+    // 이동 경로 검증/적용 (PLAYER_MOVED 병합 처리 / 시뮬레이션 스텝), 통지는 out 에 모음
+    void apply_player_moves(const std::shared_ptr<Room>& room, std::shared_ptr<Player> player,
+                            const std::vector<MoveInput>& path, OutputBatch& out);
+
+    // 관심 영역: 시야 진입/이탈 통지
+    void send_interest_changes(const std::shared_ptr<Room>& room,
+                               const std::shared_ptr<Map>& map,
+                               const std::shared_ptr<Player>& player,
+                               const InterestChange& change,
+                               OutputBatch& out);
+
+    // 지형 스트리밍: positions 주변 청크 중 아직 보내지 않은 청크를 전송
+    void stream_terrain(const std::shared_ptr<Room>& room,
+                        const std::shared_ptr<Map>& map,
+                        const std::shared_ptr<Player>& player,
+                        const std::vector<Point>& positions,
+                        OutputBatch& out);
+
+    // 틱/시뮬레이션: 맵별 변경분 스냅샷 전송
+    void send_snapshots(const std::shared_ptr<Room>& room, OutputBatch& out);
+
+    // 틱 모드: interval 후 다음 GAME_TICK 이벤트 예약
+    void schedule_game_tick(uint64_t room_id, int interval_ms);
+
+    // 방 점검: interval 후 다음 ROOM_REAP 이벤트 예약
+    void schedule_room_reap(int interval_ms);
+
+    // 시뮬레이션 모드: step 후 다음 SIMULATION_STEP 이벤트 예약
+    void schedule_simulation_step(uint64_t room_id, int step_ms);
 };
 
 #endif // GAME_EVENT_HANDLER_HPP
@@ -2,8 +2,12 @@
 #include "connection.hpp"
 #include "reactor.hpp"
 #include "utils.hpp"
+#include "room.hpp"
+#include "timer_service.hpp"
+#include "logger.hpp"
+#include "probes.hpp"
 #include <nlohmann/json.hpp>
-#include <iostream>
+#include <algorithm>
 
 using json = nlohmann::json;
 
@@ -15,7 +19,7 @@ NetworkEventHandler::NetworkEventHandler(GameManager& gm)
 void NetworkEventHandler::handle_event(const Event& event)
 {
     if (event.main_type != MainEventType::NETWORK) {
-        std::cerr << "[WARNING] NetworkEventHandler received non-NETWORK event.\n";
+        LOG_WARN("[NetworkEventHandler] received non-NETWORK event.");
         return;
     }
 
@@ -29,8 +33,17 @@ void NetworkEventHandler::handle_event(const Event& event)
     case NetworkSubType::CLOSE:
         handle_close(event);
         break;
+    case NetworkSubType::PING:
+        handle_ping(event);
+        break;
+    case NetworkSubType::PONG:
+        handle_pong(event);
+        break;
+    case NetworkSubType::HEARTBEAT:
+        handle_heartbeat(event);
+        break;
     default:
-        std::cerr << "[WARNING] Unknown NetworkSubType: " << event.sub_type << std::endl;
+        LOG_WARN("[NetworkEventHandler] Unknown NetworkSubType: " << event.sub_type);
         break;
     }
 }
@@ -60,12 +73,25 @@ void NetworkEventHandler::handle_join(const Event& event)
 
         // 2) Player 생성
         auto player = std::make_shared<Player>(player_name);
+        player->move_slot_.set_max_pending(game_manager_.config().max_pending_moves);
 
-        // 3) ConnectionManager에 연결 등록
-        ConnectionManager::get_instance().register_connection(player, conn);
+        // 3) ConnectionManager에 연결 등록 (이미 JOIN 한 커넥션이면 거절)
+        if (!ConnectionManager::get_instance().register_connection(player, conn)) {
+            LOG_WARN("[NetworkEventHandler] handle_join: connection already joined, ignored.");
+            nlohmann::json err_msg {
+                {"error", "unknown"},
+                {"result", false},
+                {"message", "already joined"}
+            };
+            std::string body = err_msg.dump();
+            auto resp = Utils::create_response_string(MainEventType::ERROR, (uint16_t)ErrorSubType::UNKNOWN, body);
+            conn->async_write(resp);
+            return;
+        }
 
-        // 4) 대기열에 추가
-        game_manager_.add_waiting_player(player);
+        // 4) 대기열에 추가 (JOIN 전에 측정된 RTT 가 있으면 매치메이킹에 사용)
+        auto rtt = conn->rtt();
+        game_manager_.add_waiting_player(player, rtt.has_sample() ? static_cast<int>(rtt.srtt_ms()) : 0);
 
         // 5) 여기서는 간단히 join 완료 알림
         {
@@ -79,22 +105,22 @@ void NetworkEventHandler::handle_join(const Event& event)
             conn->async_write(resp);
         }
 
-        // 6) 인원 수 확인 -> 5명 이상이면 ROOM_CREATE 이벤트
-        size_t waiting_count = game_manager_.waiting_count();
-        if (waiting_count >= 2) {
-            // 이벤트 enqueue: ROOM_CREATE
+        // 6) 방 편성은 매치메이커가 주기적으로 수행
+        //    (주기 0: JOIN 마다 즉시 편성 이벤트)
+        if (game_manager_.config().matchmaking_interval_ms <= 0) {
             Event ev;
             ev.main_type = MainEventType::GAME;
-            ev.sub_type = (uint16_t)GameSubType::ROOM_CREATE;
+            ev.sub_type = (uint16_t)GameSubType::MATCHMAKE;
             Reactor::get_instance().enqueue_event(ev);
         }
 
     } catch (std::exception& e) {
-        std::cerr << "[ERROR] handle_join: " << e.what() << "\n";
+        LOG_ERROR("[NetworkEventHandler] handle_join: " << e.what());
     }
 }
 
-// LEFT: 대기열 제거만 수행
+// LEFT: 대기열 제거 (게임 중이면 방에서 이탈)
+// - 빠진 플레이어는 커넥션 등록도 해제 → 같은 커넥션으로 다시 JOIN 가능
 // DATA: 클라이언트에서 "player_id, player_name" JSON 파라미터 (받지만 안씀)
 void NetworkEventHandler::handle_left(const Event& event)
 {
@@ -102,17 +128,19 @@ void NetworkEventHandler::handle_left(const Event& event)
         auto conn = get_required_connection(event, "LEFT");
         auto player = ConnectionManager::get_instance().get_player_for_connection(conn);
         if (!player) {
-            std::cerr << "[WARNING] handle_left: No player for this connection.\n";
+            LOG_WARN("[NetworkEventHandler] handle_left: No player for this connection.");
             return;
         }
 
         // 대기열에서 제거
         bool removed = game_manager_.remove_waiting_player(player);
-        if (removed) {
+        bool left_room = !removed && leave_room(player);
+        if (removed || left_room) {
+            ConnectionManager::get_instance().unregister_connection(player);
             nlohmann::json ack_msg {
                 {"action", "left"},
                 {"result", true},
-                {"message", "removed from waiting list"}
+                {"message", removed ? "removed from waiting list" : "left the room"}
             };
             std::string body = ack_msg.dump();
             auto resp = Utils::create_response_string(MainEventType::NETWORK, (uint16_t)NetworkSubType::LEFT, body);
@@ -129,7 +157,7 @@ void NetworkEventHandler::handle_left(const Event& event)
         }
 
     } catch (std::exception& e) {
-        std::cerr << "[ERROR] handle_left: " << e.what() << "\n";
+        LOG_ERROR("[NetworkEventHandler] handle_left: " << e.what());
     }
 }
 
@@ -137,20 +165,168 @@ void NetworkEventHandler::handle_close(const Event& event)
 {
     try {
         auto conn = get_required_connection(event, "CLOSE");
+        SERVER_PROBE1(connection_close, PROBE_CONN_ID(conn.get()));
         auto player = ConnectionManager::get_instance().get_player_for_connection(conn);
         if (player) {
-            game_manager_.remove_waiting_player(player);
+            if (!game_manager_.remove_waiting_player(player)) {
+                leave_room(player);
+            }
             ConnectionManager::get_instance().unregister_connection(player);
         }
+        ConnectionManager::get_instance().remove_connection(conn);
         // 소켓 닫기
         if (conn->get_socket().is_open()) {
             boost::system::error_code ec;
             conn->get_socket().close(ec);
             if (ec) {
-                std::cerr << "[ERROR] handle_close: " << ec.message() << "\n";
+                LOG_ERROR("[NetworkEventHandler] handle_close: " << ec.message());
             }
         }
     } catch (std::exception& e) {
-        std::cerr << "[ERROR] handle_close: " << e.what() << "\n";
+        LOG_ERROR("[NetworkEventHandler] handle_close: " << e.what());
+    }
+}
+
+/**
+ * 게임 중인 방에서 이탈
+ * - 플레이어의 방 연결 해제 (이후 이동 입력은 무시)
+ * - 현재 맵 플레이어에게 player_come_out_map 통지
+ * - 남은 플레이어가 없으면 방 즉시 제거 (GAME_END 를 받을 대상이 없음)
+ * - 남은 플레이어가 모두 도착한 상태면 GAME_END
+ */
+bool NetworkEventHandler::leave_room(const std::shared_ptr<Player>& player)
+{
+    uint64_t room_id = player->room_id();
+    if (room_id == 0) {
+        return false;
+    }
+    auto room = game_manager_.find_room(room_id);
+    if (!room) {
+        return false;
+    }
+
+    auto cur_map = player->current_map();
+    room->remove_player(player);
+    player->reset_room();
+
+    if (cur_map) {
+        nlohmann::json broadcast_msg {
+            {"action", "player_come_out_map"},
+            {"result", true},
+            {"player_id", player->id_},
+            {"map", cur_map->name}
+        };
+        auto resp = Utils::create_response_string(MainEventType::GAME, (uint16_t)GameSubType::PLAYER_COME_OUT_MAP, broadcast_msg.dump());
+        cur_map->broadcast_in_map(resp);
+    }
+
+    if (room->present_count() == 0) {
+        LOG_INFO("[NetworkEventHandler] room " << room->id_ << " abandoned, removed.");
+        game_manager_.remove_room(room->id_);
+    } else if (room->is_all_players_finished()) {
+        GameEventHandler::request_game_end(room, "finished");
+    }
+    return true;
+}
+
+// PING (클라이언트 → 서버): 같은 body 로 PONG 응답 (클라이언트 측 RTT 측정용)
+void NetworkEventHandler::handle_ping(const Event& event)
+{
+    try {
+        auto conn = get_required_connection(event, "PING");
+        std::string body(event.data.begin(), event.data.end());
+        auto resp = Utils::create_response_string(MainEventType::NETWORK, (uint16_t)NetworkSubType::PONG, body);
+        conn->async_write(resp);
+    } catch (std::exception& e) {
+        LOG_ERROR("[NetworkEventHandler] handle_ping: " << e.what());
+    }
+}
+
+// PONG (클라이언트 → 서버): 서버가 보낸 PING 의 seq 확인 후 RTT 반영
+// DATA: {"action":"ping","seq":N} 를 그대로 돌려받음
+void NetworkEventHandler::handle_pong(const Event& event)
+{
+    try {
+        auto conn = get_required_connection(event, "PONG");
+        json parsed = json::parse(event.data);
+        if (!conn->complete_ping(parsed.value("seq", 0u))) {
+            return;
+        }
+
+        // 대기 중인 플레이어면 매치메이킹 RTT 갱신
+        auto player = conn->get_player();
+        if (player && player->room_id() == 0) {
+            game_manager_.matchmaker().update_rtt(player, static_cast<int>(conn->rtt().srtt_ms()));
+        }
+    } catch (std::exception& e) {
+        LOG_ERROR("[NetworkEventHandler] handle_pong: " << e.what());
+    }
+}
+
+/**
+ * HEARTBEAT (내부 이벤트, 주기 실행)
+ * - idle_timeout_ms 동안 아무것도 받지 못한 커넥션은 소켓을 닫음 (이후 CLOSE 이벤트로 정리)
+ * - 나머지 커넥션에는 PING 전송 {"action":"ping","seq":N}
+ *   (이전 PING 의 PONG 을 기다리는 중이면 응답 한도(ping_timeout_ms)까지 새 PING 을 보내지 않음)
+ * - 타이머는 서버 전체에 하나 (커넥션마다 타이머를 두지 않음)
+ */
+void NetworkEventHandler::handle_heartbeat(const Event& event)
+{
+    if (event.connection.has_value()) {
+        return; // 클라이언트가 보낸 내부 이벤트는 무시
+    }
+
+    const auto& config = game_manager_.config();
+    for (const auto& conn : ConnectionManager::get_instance().get_all_connections()) {
+        if (config.idle_timeout_ms > 0 && conn->idle_ms() >= config.idle_timeout_ms) {
+            LOG_INFO("[NetworkEventHandler] idle timeout, closing connection.");
+            conn->close();
+            continue;
+        }
+        if (config.heartbeat_interval_ms > 0) {
+            uint32_t seq = conn->begin_ping(ping_timeout_ms(config));
+            if (seq == 0) {
+                continue;
+            }
+            nlohmann::json ping_msg {
+                {"action", "ping"},
+                {"seq", seq}
+            };
+            auto resp = Utils::create_response_string(MainEventType::NETWORK, (uint16_t)NetworkSubType::PING, ping_msg.dump());
+            conn->async_write(resp);
+        }
+    }
+
+    schedule_heartbeat(heartbeat_sweep_interval_ms(config));
+}
+
+// 점검 주기: PING 주기, PING 이 꺼져 있으면 유휴 시간 제한의 절반
+int NetworkEventHandler::heartbeat_sweep_interval_ms(const ServerConfig& config)
+{
+    if (config.heartbeat_interval_ms > 0) {
+        return config.heartbeat_interval_ms;
+    }
+    if (config.idle_timeout_ms > 0) {
+        return std::max(1, config.idle_timeout_ms / 2);
+    }
+    return 0;
+}
+
+// PING 응답 대기 한도: PING 주기의 4배, 유휴 시간 제한이 더 길면 그만큼
+int NetworkEventHandler::ping_timeout_ms(const ServerConfig& config)
+{
+    return std::max(config.idle_timeout_ms, 4 * config.heartbeat_interval_ms);
+}
+
+void NetworkEventHandler::schedule_heartbeat(int interval_ms)
+{
+    if (interval_ms <= 0) {
+        return;
     }
+    TimerService::get_instance().schedule_after(std::chrono::milliseconds(interval_ms), [](){
+        Event next;
+        next.main_type = MainEventType::NETWORK;
+        next.sub_type  = (uint16_t)NetworkSubType::HEARTBEAT;
+        Reactor::get_instance().enqueue_event(next);
+    });
 }
@@ -13,6 +13,12 @@ public:
     // 이벤트 처리 함수
     void handle_event(const Event& event);
 
+    // 하트비트 점검 주기 (0이면 비활성) / 다음 점검 예약 (TimerService)
+    static int heartbeat_sweep_interval_ms(const ServerConfig& config);
+    // PING 응답 대기 한도 (지나면 응답 없는 PING 을 버리고 새로 보냄)
+    static int ping_timeout_ms(const ServerConfig& config);
+    static void schedule_heartbeat(int interval_ms);
+
 private:
     GameManager& game_manager_;
 
@@ -20,6 +26,13 @@ private:
     void handle_join(const Event& event);
     void handle_left(const Event& event);
     void handle_close(const Event& event);
+    void handle_ping(const Event& event);
+    void handle_pong(const Event& event);
+    void handle_heartbeat(const Event& event);
+
+    // 게임 중인 방에서 이탈 (LEFT / CLOSE)
+    // - 맵/방 상태에서 제거, 남은 플레이어가 없으면 방 제거, 남은 플레이어가 모두 도착했으면 GAME_END
+    bool leave_room(const std::shared_ptr<Player>& player);
 
     // 유틸
     std::shared_ptr<Connection> get_required_connection(const Event& event, const char* context_name);
@@ -0,0 +1,61 @@
+#include "output_batch.hpp"
+#include "map.hpp"
+#include "room.hpp"
+#include "tracer.hpp"
+
+void OutputBatch::send(const std::shared_ptr<Player>& player, const std::string& frame)
+{
+    if (!player) {
+        return;
+    }
+    auto [it, inserted] = index_.try_emplace(player.get(), pending_.size());
+    if (inserted) {
+        pending_.push_back(Pending{player, frame, 1});
+    } else {
+        auto& entry = pending_[it->second];
+        entry.frames += frame;
+        ++entry.count;
+    }
+}
+
+void OutputBatch::send_to_map(const Map& map, const std::string& frame, const std::shared_ptr<Player>& exclude)
+{
+    auto players = map.get_players_snapshot();
+    for (auto& p : *players) {
+        if (p == exclude) continue;
+        send(p, frame);
+    }
+}
+
+void OutputBatch::send_to_observers(const Map& map, const Point& pos, const std::string& frame, const std::shared_ptr<Player>& exclude)
+{
+    if (!map.has_interest_management()) {
+        send_to_map(map, frame, exclude);
+        return;
+    }
+    for (auto& p : map.get_observers(pos)) {
+        if (p == exclude) continue;
+        send(p, frame);
+    }
+}
+
+void OutputBatch::send_to_room(const Room& room, const std::string& frame)
+{
+    for (auto& p : room.get_all_players()) {
+        send(p, frame);
+    }
+}
+
+/**
+ * 수신자별로 이어붙인 프레임을 한 번에 송신 큐에 넣음
+ * (프레임마다 8바이트 정렬되어 있으므로 그대로 이어붙여도 클라이언트가 순서대로 읽을 수 있음)
+ */
+void OutputBatch::flush()
+{
+    TRACE_SPAN("flush_output", 0);
+    for (auto& entry : pending_) {
+        entry.player->send_message(entry.frames, entry.count);
+    }
+    pending_.clear();
+    index_.clear();
+}
@@ -0,0 +1,54 @@
+#ifndef OUTPUT_BATCH_HPP
+#define OUTPUT_BATCH_HPP
+
+#include "player.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Map;
+class Room;
+struct Point;
+
+/**
+ * OutputBatch
+ *  - 핸들러가 한 번의 처리(이동 묶음 / 틱 / 시뮬레이션 스텝) 동안 보낼 프레임을 수신자별로 모아둠
+ *  - flush() 에서 수신자마다 모은 프레임을 이어붙여 한 번만 송신 큐에 넣음
+ *  - 맵/방 브로드캐스트의 수신자는 추가 시점에 정해짐 (바로 보낼 때와 같은 대상)
+ *  - 한 스레드(이벤트 하나) 안에서만 사용
+ */
+class OutputBatch {
+public:
+    // 플레이어 한 명에게
+    void send(const std::shared_ptr<Player>& player, const std::string& frame);
+
+    // 맵에 있는 플레이어에게 (exclude 는 제외)
+    void send_to_map(const Map& map, const std::string& frame, const std::shared_ptr<Player>& exclude = nullptr);
+
+    // 맵에서 pos 를 시야에 둔 플레이어에게 (관심 영역 비활성이면 맵 전체, exclude 는 제외)
+    void send_to_observers(const Map& map, const Point& pos, const std::string& frame, const std::shared_ptr<Player>& exclude = nullptr);
+
+    // 방에 남아있는 모든 플레이어에게
+    void send_to_room(const Room& room, const std::string& frame);
+
+    // 모은 프레임 전송 (수신자당 한 번, 처음 추가된 순서대로)
+    void flush();
+
+    bool empty() const { return pending_.empty(); }
+    std::size_t recipient_count() const { return pending_.size(); }
+
+private:
+    struct Pending {
+        std::shared_ptr<Player> player;
+        std::string frames;      // 이어붙인 프레임
+        std::size_t count = 0;   // 이어붙인 프레임 수
+    };
+
+    std::vector<Pending> pending_;
+    std::unordered_map<const Player*, std::size_t> index_; // 수신자 → pending_ 위치
+};
+
+#endif // OUTPUT_BATCH_HPP
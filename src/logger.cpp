@@ -0,0 +1,231 @@
+#include "logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+
+namespace {
+
+const char* level_name(uint8_t level) {
+    switch (static_cast<LogLevel>(level)) {
+    case LogLevel::TRACE: return "TRACE";
+    case LogLevel::DEBUG: return "DEBUG";
+    case LogLevel::INFO:  return "INFO";
+    case LogLevel::WARN:  return "WARN";
+    case LogLevel::ERROR: return "ERROR";
+    default:              return "?";
+    }
+}
+
+// Logger::Line 용 스레드 로컬 스트림 (중첩 깊이별 하나, 한 번 만든 스트림은 재사용)
+struct LineStreams {
+    std::vector<std::unique_ptr<std::ostringstream>> streams;
+    std::size_t depth = 0;
+};
+
+LineStreams& line_streams()
+{
+    thread_local LineStreams streams;
+    return streams;
+}
+
+} // namespace
+
+Logger::Logger()
+    : writer_([this]() { run(); })
+{
+}
+
+Logger::~Logger()
+{
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stop_ = true;
+    }
+    wake_cv_.notify_one();
+    writer_.join();
+
+    flush();
+    std::lock_guard<std::mutex> lock(output_mutex_);
+    if (out_ != stdout) {
+        std::fclose(out_);
+        out_ = stdout;
+    }
+}
+
+bool Logger::set_output_file(const std::string& path)
+{
+    std::FILE* file = stdout;
+    if (!path.empty()) {
+        file = std::fopen(path.c_str(), "a");
+        if (!file) {
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(output_mutex_);
+    if (out_ != stdout) {
+        std::fclose(out_);
+    }
+    out_ = file;
+    return true;
+}
+
+LogLevel Logger::parse_level(const std::string& name, LogLevel fallback)
+{
+    if (name == "trace") return LogLevel::TRACE;
+    if (name == "debug") return LogLevel::DEBUG;
+    if (name == "info")  return LogLevel::INFO;
+    if (name == "warn")  return LogLevel::WARN;
+    if (name == "error") return LogLevel::ERROR;
+    if (name == "off")   return LogLevel::OFF;
+    return fallback;
+}
+
+/**
+ * 호출 스레드 전용 링 (처음 로그를 남길 때 생성해 writer 에 등록)
+ * - 스레드가 종료돼도 링은 rings_ 가 소유 → 남은 줄은 그대로 출력됨
+ */
+Logger::Ring& Logger::local_ring()
+{
+    thread_local std::shared_ptr<Ring> ring;
+    if (!ring) {
+        ring = std::make_shared<Ring>();
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        ring->thread_no = static_cast<uint32_t>(rings_.size());
+        rings_.push_back(ring);
+    }
+    return *ring;
+}
+
+/**
+ * 한 줄 기록
+ * - 링에 빈 칸이 있으면 복사 후 tail 전진 (락/시스템 콜 없음)
+ * - 가득 차면 버리고 dropped 증가
+ */
+void Logger::write(LogLevel level, const char* msg, std::size_t len)
+{
+    Ring& ring = local_ring();
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail - ring.head.load(std::memory_order_acquire) >= kRingCapacity) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Record& rec = ring.records[tail & (kRingCapacity - 1)];
+    rec.time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    rec.thread_no = ring.thread_no;
+    rec.level = static_cast<uint8_t>(level);
+    rec.length = static_cast<uint16_t>(std::min(len, kMaxMessage));
+    std::memcpy(rec.text, msg, rec.length);
+    ring.tail.store(tail + 1, std::memory_order_release);
+
+    // 에러는 바로 출력되도록 writer 를 깨움
+    if (level >= LogLevel::ERROR) {
+        wake_cv_.notify_one();
+    }
+}
+
+void Logger::flush()
+{
+    drain();
+}
+
+uint64_t Logger::dropped_count() const
+{
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    uint64_t total = 0;
+    for (const auto& ring : rings_) {
+        total += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+/**
+ * 모든 링의 대기 줄을 출력
+ * - 형식: "HH:MM:SS.mmm [LEVEL] (tN) message"
+ * - output_mutex_ 로 소비자를 하나로 유지 (writer / flush)
+ */
+bool Logger::drain()
+{
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings = rings_;
+    }
+
+    std::lock_guard<std::mutex> lock(output_mutex_);
+    bool wrote = false;
+    uint64_t dropped = 0;
+    char prefix[64];
+
+    for (const auto& ring : rings) {
+        uint64_t head = ring->head.load(std::memory_order_relaxed);
+        const uint64_t tail = ring->tail.load(std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            const Record& rec = ring->records[head & (kRingCapacity - 1)];
+            std::time_t secs = static_cast<std::time_t>(rec.time_us / 1000000);
+            std::tm tm{};
+            localtime_r(&secs, &tm);
+            int n = std::snprintf(prefix, sizeof(prefix), "%02d:%02d:%02d.%03d [%s] (t%u) ",
+                                  tm.tm_hour, tm.tm_min, tm.tm_sec,
+                                  static_cast<int>((rec.time_us / 1000) % 1000),
+                                  level_name(rec.level), rec.thread_no);
+            std::fwrite(prefix, 1, static_cast<std::size_t>(n), out_);
+            std::fwrite(rec.text, 1, rec.length, out_);
+            if (rec.length == 0 || rec.text[rec.length - 1] != '\n') {
+                std::fputc('\n', out_);
+            }
+            wrote = true;
+        }
+        ring->head.store(tail, std::memory_order_release);
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+
+    if (dropped != reported_dropped_) {
+        std::fprintf(out_, "[Logger] dropped %llu log lines (ring full)\n",
+                     static_cast<unsigned long long>(dropped - reported_dropped_));
+        reported_dropped_ = dropped;
+        wrote = true;
+    }
+    if (wrote) {
+        std::fflush(out_);
+    }
+    return wrote;
+}
+
+// writer 스레드: 출력할 줄이 없으면 잠시 대기 (생산자는 깨우지 않으므로 주기적으로 확인)
+void Logger::run()
+{
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    while (!stop_) {
+        lock.unlock();
+        bool wrote = drain();
+        lock.lock();
+        if (!wrote && !stop_) {
+            wake_cv_.wait_for(lock, std::chrono::milliseconds(5));
+        }
+    }
+}
+
+Logger::Line::Line(LogLevel level)
+    : level_(level)
+    , stream_([]() -> std::ostringstream& {
+        auto& pool = line_streams();
+        if (pool.depth == pool.streams.size()) {
+            pool.streams.push_back(std::make_unique<std::ostringstream>());
+        }
+        return *pool.streams[pool.depth++];
+    }())
+{
+    stream_.str(std::string());
+    stream_.clear();
+}
+
+Logger::Line::~Line()
+{
+    const std::string text = stream_.str();
+    Logger::get_instance().write(level_, text.data(), text.size());
+    --line_streams().depth;
+}
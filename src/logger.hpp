@@ -0,0 +1,151 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 로그 레벨 (컴파일 타임 필터용 정수값)
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_WARN  3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_OFF   5
+
+// 컴파일 타임 최소 레벨: 이보다 낮은 로그는 코드 자체가 제거됨
+// (예: -DLOG_COMPILE_LEVEL=LOG_LEVEL_INFO)
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+enum class LogLevel : int {
+    TRACE = LOG_LEVEL_TRACE,
+    DEBUG = LOG_LEVEL_DEBUG,
+    INFO  = LOG_LEVEL_INFO,
+    WARN  = LOG_LEVEL_WARN,
+    ERROR = LOG_LEVEL_ERROR,
+    OFF   = LOG_LEVEL_OFF,
+};
+
+/**
+ * Logger
+ *  - 비동기 로거: 호출 스레드는 자기 스레드 전용 링 버퍼(SPSC)에 한 줄을 복사만 하고 반환
+ *  - 백그라운드 writer 스레드가 모든 링을 모아 출력 (stdout 또는 파일)
+ *  - 런타임 레벨 검사는 atomic load 1회 → 꺼진 로그는 메시지 포맷팅도 하지 않음
+ *  - 링이 가득 차면 기다리지 않고 버림 (버린 수는 writer 가 주기적으로 출력)
+ *  - 스레드 간 출력 순서는 보장하지 않음 (각 줄에 시각 포함)
+ */
+class Logger {
+public:
+    static constexpr std::size_t kMaxMessage = 232;    // 한 줄 최대 길이 (초과분은 잘림)
+    static constexpr std::size_t kRingCapacity = 512;  // 스레드당 대기 줄 수 (2의 거듭제곱)
+
+    static Logger& get_instance() {
+        static Logger instance;
+        return instance;
+    }
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    // 런타임 설정: 최소 레벨, 출력 파일 ("" 이면 stdout)
+    void set_level(LogLevel level) { level_.store(static_cast<int>(level), std::memory_order_relaxed); }
+    LogLevel level() const { return static_cast<LogLevel>(level_.load(std::memory_order_relaxed)); }
+    bool set_output_file(const std::string& path);
+
+    bool is_enabled(LogLevel level) const {
+        return static_cast<int>(level) >= level_.load(std::memory_order_relaxed);
+    }
+
+    // 한 줄 기록 (호출 스레드 링에 복사)
+    void write(LogLevel level, const char* msg, std::size_t len);
+
+    // 지금까지 기록된 로그를 모두 출력할 때까지 대기
+    void flush();
+
+    // 링이 가득 차 버려진 줄 수 (누적)
+    uint64_t dropped_count() const;
+
+    // "trace" / "debug" / "info" / "warn" / "error" / "off" (알 수 없으면 fallback)
+    static LogLevel parse_level(const std::string& name, LogLevel fallback = LogLevel::INFO);
+
+    // 매크로용: 스레드 로컬 스트림에 포맷팅 후 소멸 시 write
+    //  - 스트림은 중첩 깊이별로 따로 둠 → 인자 평가 중 다른 로그를 남겨도 바깥 줄이 섞이지 않음
+    class Line {
+    public:
+        explicit Line(LogLevel level);
+        ~Line();
+        std::ostream& stream() { return stream_; }
+    private:
+        LogLevel level_;
+        std::ostringstream& stream_;
+    };
+
+private:
+    Logger();
+    ~Logger();
+
+    struct Record {
+        int64_t time_us;     // system_clock 기준 (epoch 이후 us)
+        uint32_t thread_no;  // 링 등록 순서
+        uint16_t length;
+        uint8_t level;
+        char text[kMaxMessage];
+    };
+
+    // 단일 생산자(소유 스레드) / 단일 소비자(writer) 링
+    struct Ring {
+        Record records[kRingCapacity];
+        std::atomic<uint64_t> head{0}; // 소비 위치 (writer)
+        std::atomic<uint64_t> tail{0}; // 생산 위치 (소유 스레드)
+        std::atomic<uint64_t> dropped{0};
+        uint32_t thread_no = 0;
+    };
+
+    Ring& local_ring();
+    bool drain(); // 모든 링 출력, 출력한 줄이 있으면 true
+    void run();
+
+    std::atomic<int> level_{static_cast<int>(LogLevel::INFO)};
+
+    mutable std::mutex rings_mutex_;         // rings_ 등록 보호
+    std::vector<std::shared_ptr<Ring>> rings_;
+
+    std::mutex output_mutex_;                // out_ / drain 직렬화
+    std::FILE* out_ = stdout;
+    uint64_t reported_dropped_ = 0;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    bool stop_ = false;
+    std::thread writer_;
+};
+
+// 레벨별 로그 매크로
+//  - 사용법: LOG_INFO("[Room:" << id_ << "] created");
+//  - 컴파일 타임 레벨 미만이면 조건이 상수 false → 코드 제거
+//  - 런타임 레벨 미만이면 인자 평가/포맷팅 없이 바로 넘어감
+#define LOG_AT(level, expr)                                                          \
+    do {                                                                             \
+        if (static_cast<int>(level) >= LOG_COMPILE_LEVEL &&                          \
+            Logger::get_instance().is_enabled(level)) {                              \
+            Logger::Line log_line_(level);                                           \
+            log_line_.stream() << expr;                                              \
+        }                                                                            \
+    } while (0)
+
+#define LOG_TRACE(expr) LOG_AT(LogLevel::TRACE, expr)
+#define LOG_DEBUG(expr) LOG_AT(LogLevel::DEBUG, expr)
+#define LOG_INFO(expr)  LOG_AT(LogLevel::INFO, expr)
+#define LOG_WARN(expr)  LOG_AT(LogLevel::WARN, expr)
+#define LOG_ERROR(expr) LOG_AT(LogLevel::ERROR, expr)
+
+#endif // LOGGER_HPP
@@ -1,10 +1,23 @@
 #include <iostream>
 #include "game_server_app.hpp"
+#include "server_config.hpp"
+#include "logger.hpp"
 
 // main.cpp
-int main() {
-    std::cout << "[main] Starting GameServerApp..." << std::endl;
-    GameServerApp app;
+// 사용법: asio_server [config.json]
+int main(int argc, char* argv[]) {
+    ServerConfig config;
+    if (argc > 1) {
+        try {
+            config = ServerConfig::load_from_file(argv[1]);
+        } catch (const std::exception& e) {
+            std::cerr << "[main] Failed to load config: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    LOG_INFO("[main] Starting GameServerApp...");
+    GameServerApp app(config);
     app.start();
     return 0;
 }
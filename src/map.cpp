@@ -1,21 +1,32 @@
 #include "map.hpp"
+#include "logger.hpp"
+#include "tracer.hpp"
 #include <algorithm>
-#include <iostream>
 #include <cstdlib> // rand
 #include <stack>
 #include <queue>
 #include <set>
 #include <random>
 
-Map::Map(const std::string& name, int width, int height)
+Map::Map(const std::string& name, int width, int height,
+         std::shared_ptr<std::pmr::memory_resource> arena)
     : name(name)
     , max_width(width)
     , max_height(height)
+    , arena_(std::move(arena))
+    , portals_(arena_ ? arena_.get() : std::pmr::get_default_resource())
+    , obstacles_(arena_ ? arena_.get() : std::pmr::get_default_resource())
+    , chunk_obstacles_(arena_ ? arena_.get() : std::pmr::get_default_resource())
 {
     std::seed_seq seed_seq{std::random_device{}(), static_cast<unsigned int>(std::chrono::steady_clock::now().time_since_epoch().count())};
     rng_.seed(seed_seq);
 }
 
+void Map::set_seed(uint32_t seed)
+{
+    rng_.seed(seed);
+}
+
 /**
  * 해당 포지션이 도착 위치인지 확인
  * (플레이어 이동 시, 도착지인지 확인용)
@@ -75,8 +86,8 @@ std::string Map::generate_random_portal(const std::string& linked_map_name)
     portal.linked_map_name = linked_map_name;
     portals_.push_back(portal);
 
-    std::cout << "[Map] 포탈 생성 완료: " << portal.name
-              << " at (" << portal.position.x << ", " << portal.position.y << ")\n";
+    LOG_DEBUG("[Map] 포탈 생성 완료: " << portal.name
+              << " at (" << portal.position.x << ", " << portal.position.y << ")");
 
     return portal.name;
 }
@@ -168,13 +179,13 @@ void Map::generate_random_obstacles(bool is_end)
                 std::find(targets.begin(), targets.end(), dummy_target) == targets.end()) {
                 targets.push_back(dummy_target);
                 far_target_added = true;
-                std::cout << "[Map] 최소 거리 만족 더미 지점 추가: (" << dummy_target.x << ", " << dummy_target.y << ")\n";
+                LOG_DEBUG("[Map] 최소 거리 만족 더미 지점 추가: (" << dummy_target.x << ", " << dummy_target.y << ")");
             }
             dummy_attempt++;
         }
 
         if (!far_target_added) {
-            std::cerr << "[Map] 최소 거리 만족하는 더미 지점 생성 실패. 추가 시도합니다.\n";
+            LOG_WARN("[Map] 최소 거리 만족하는 더미 지점 생성 실패. 추가 시도합니다.");
             attempt++;
             continue;
         }
@@ -190,7 +201,7 @@ void Map::generate_random_obstacles(bool is_end)
                 std::find(targets.begin(), targets.end(), dummy_target) == targets.end()) {
                 targets.push_back(dummy_target);
                 remaining_targets--;
-                std::cout << "[Map] 추가 더미 지점 추가: (" << dummy_target.x << ", " << dummy_target.y << ")\n";
+                LOG_DEBUG("[Map] 추가 더미 지점 추가: (" << dummy_target.x << ", " << dummy_target.y << ")");
             }
             dummy_attempt++;
         }
@@ -233,11 +244,11 @@ void Map::generate_random_obstacles(bool is_end)
         }
 
         attempt++; // 재시도 횟수 증가
-        std::cout << "[Map] Attempt " << attempt << ": Obstacles count = " << obstacles_.size() << "\n";
+        LOG_DEBUG("[Map] Attempt " << attempt << ": Obstacles count = " << obstacles_.size());
 
     } while (!is_paths_connected(start_point, main_target) || obstacles_.size() < min_obstacles);
 
-    std::cout << "[Map] 맵 생성 완료. 장애물 수: " << obstacles_.size() << "\n";
+    LOG_DEBUG("[Map] 맵 생성 완료. 장애물 수: " << obstacles_.size());
 }
 
 // 경로 연결 여부 확인 함수
@@ -270,7 +281,7 @@ bool Map::is_paths_connected(const Point& start, const Point& target)
         }
     }
 
-    std::cout << "[Map] 포탈 또는 종료 지점에 도달할 수 없습니다. 재생성합니다." << "\n";
+    LOG_DEBUG("[Map] 포탈 또는 종료 지점에 도달할 수 없습니다. 재생성합니다.");
     return false;
 }
 
@@ -297,18 +308,24 @@ bool Map::is_valid_position(const Point& pos) const {
 
 /**
  * 맵에 특정 플레이어 추가
- * 
+ * - 현재 스냅샷을 복사해 추가한 뒤, 새 스냅샷으로 교체 (copy-on-write)
+ * - 이미 스냅샷을 잡고 순회 중인 브로드캐스트는 이전 목록을 그대로 사용
  */
-bool Map::add_player(std::shared_ptr<Player> p)
+bool Map::add_player(std::shared_ptr<Player> p, const Point& position)
 {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    auto it = std::find(map_players_.begin(), map_players_.end(), p);
-    if(it != map_players_.end()){
+    std::lock_guard<ProfiledMutex> lock(map_mutex_);
+    auto current = std::atomic_load(&map_players_);
+    if(std::find(current->begin(), current->end(), p) != current->end()){
         return false; // already in this map
     }
-    map_players_.push_back(p);
+    auto next = std::make_shared<PlayerList>(*current);
+    next->push_back(p);
+    std::atomic_store(&map_players_, PlayerListPtr(std::move(next)));
+    if (grid_) {
+        grid_->insert(p, position);
+    }
     // debug
-    std::cout << "[Map:" << name << "] add_player " << p->id_ << ", total=" << map_players_.size() << "\n";
+    LOG_DEBUG("[Map:" << name << "] add_player " << p->id_ << ", total=" << current->size() + 1);
     return true;
 }
 
@@ -318,12 +335,20 @@ bool Map::add_player(std::shared_ptr<Player> p)
  */
 bool Map::remove_player(std::shared_ptr<Player> p)
 {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    auto it = std::find(map_players_.begin(), map_players_.end(), p);
-    if(it != map_players_.end()){
-        map_players_.erase(it);
-        std::cout << "[Map:" << name << "] remove_player " << p->id_ 
-                  << ", total=" << map_players_.size() << "\n";
+    std::lock_guard<ProfiledMutex> lock(map_mutex_);
+    auto current = std::atomic_load(&map_players_);
+    auto it = std::find(current->begin(), current->end(), p);
+    if(it != current->end()){
+        auto next = std::make_shared<PlayerList>();
+        next->reserve(current->size() - 1);
+        next->insert(next->end(), current->begin(), it);
+        next->insert(next->end(), it + 1, current->end());
+        std::atomic_store(&map_players_, PlayerListPtr(std::move(next)));
+        if (grid_) {
+            grid_->remove(p);
+        }
+        LOG_DEBUG("[Map:" << name << "] remove_player " << p->id_ 
+                  << ", total=" << current->size() - 1);
         return true;
     }
     return false;
@@ -332,11 +357,11 @@ bool Map::remove_player(std::shared_ptr<Player> p)
 /**
  * 맵에서 특정 플레이어 찾기
  */
-std::shared_ptr<Player> Map::find_player(const std::string& player_id)
+std::shared_ptr<Player> Map::find_player(SlotHandle player_handle)
 {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    for(auto& pl : map_players_){
-        if(pl->id_ == player_id) return pl;
+    auto players = get_players_snapshot();
+    for(auto& pl : *players){
+        if(pl->handle_ == player_handle) return pl;
     }
     return nullptr;
 }
@@ -346,8 +371,16 @@ std::shared_ptr<Player> Map::find_player(const std::string& player_id)
  */
 std::vector<std::shared_ptr<Player>> Map::get_players() const
 {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    return map_players_;
+    return *get_players_snapshot();
+}
+
+/**
+ * 맵 내 플레이어 목록 스냅샷 반환 (락 없음, 복사 없음)
+ * - 반환된 목록은 불변이며, 이후 입장/퇴장은 반영되지 않음
+ */
+Map::PlayerListPtr Map::get_players_snapshot() const
+{
+    return std::atomic_load(&map_players_);
 }
 
 /** 
@@ -366,16 +399,13 @@ std::vector<std::shared_ptr<Player>> Map::get_players() const
  *      {"x":..., "y":...},
  *      ...
  *   ]
- *   "players": [
- *      {"id": "player1", "name": "TestUser1", "position": {"x": 10, "y": 20}},
- *      {"id": "player2", "name": "TestUser2", "position": {"x": 15, "y": 25}},
- *      ...
- *   ]
+ *   (지형 스트리밍 시: "obstacles": [], "terrain_chunk_size": 8)
  * }
+ * (플레이어 목록 "players" 는 Room::extract_all_map_info 가 방 상태에서 채움)
  */
-nlohmann::json Map::extract_map_info() const
+nlohmann::json Map::extract_map_info(bool include_obstacles) const
 {
-    std::lock_guard<std::mutex> lock(map_mutex_);
+    // 지형 정보는 맵 생성 후 변경되지 않으므로 락 불필요
 
     nlohmann::json map_info;
     map_info["name"]   = name;
@@ -411,75 +441,178 @@ nlohmann::json Map::extract_map_info() const
 
     // obstacles
     nlohmann::json obstacle_array = nlohmann::json::array();
-    for (auto& obs : obstacles_) {
-        nlohmann::json ojson;
-        ojson["x"] = obs.position.x;
-        ojson["y"] = obs.position.y;
-        obstacle_array.push_back(ojson);
+    if (include_obstacles) {
+        for (auto& obs : obstacles_) {
+            nlohmann::json ojson;
+            ojson["x"] = obs.position.x;
+            ojson["y"] = obs.position.y;
+            obstacle_array.push_back(ojson);
+        }
+    } else {
+        map_info["terrain_chunk_size"] = chunk_size_;
     }
     map_info["obstacles"] = obstacle_array;
 
-    // players
-    nlohmann::json players_array = nlohmann::json::array();
-    for (const auto& player_ptr : map_players_) {
-        if (player_ptr) { // nullptr 체크
-            nlohmann::json pjson;
-            pjson["id"] = player_ptr->id_;
-            pjson["name"] = player_ptr->name_;
-            pjson["position"] = {
-                {"x", player_ptr->position_.x},
-                {"y", player_ptr->position_.y}
-            };
-            players_array.push_back(pjson);
+    return map_info;
+}
+
+/**
+ * 맵 전용 브로드캐스트
+ * 해당 맵에 있는 플레이어에게 메시지 전송 (exclude 는 제외)
+ */
+void Map::broadcast_in_map(const std::string& msg, const std::shared_ptr<Player>& exclude)
+{
+    TRACE_SPAN("broadcast_in_map", 0);
+    // 스냅샷 순회: 전송 중에도 입장/퇴장(포탈 이동)이 막히지 않음
+    auto players = get_players_snapshot();
+    for(auto& p : *players) {
+        if (p == exclude) continue;
+        p->send_message(msg);
+    }
+}
+
+/**
+ * 관심 영역 활성화
+ * - 셀 크기 = 시야 반경 → 시야 조회 시 주변 3x3 셀만 확인
+ * - 위치는 방 상태가 가지므로, 이미 맵에 있는 플레이어는 색인하지 않음 (입장 전에 호출)
+ */
+void Map::set_view_radius(int radius)
+{
+    std::lock_guard<ProfiledMutex> lock(map_mutex_);
+    view_radius_ = radius;
+    if (radius <= 0) {
+        grid_.reset();
+        return;
+    }
+    grid_ = std::make_unique<SpatialGrid>(max_width, max_height, radius);
+    if (!get_players_snapshot()->empty()) {
+        LOG_WARN("[Map:" << name << "] set_view_radius after players joined; they are indexed on their next move.");
+    }
+}
+
+/**
+ * 관심 영역: 플레이어 이동 처리
+ * - 격자 위치를 new_pos 로 갱신 (색인되지 않은 플레이어는 새로 색인)
+ * - 이전/이후 위치를 시야에 둔 다른 플레이어를 moved / entered / left 로 분류
+ */
+InterestChange Map::update_player_interest(const std::shared_ptr<Player>& p, const Point& old_pos, const Point& new_pos)
+{
+    InterestChange change;
+
+    std::lock_guard<ProfiledMutex> lock(map_mutex_);
+    if (!grid_) {
+        return change;
+    }
+
+    grid_->move(p, new_pos);
+
+    auto candidates = grid_->query(old_pos, view_radius_);
+    auto near_new = grid_->query(new_pos, view_radius_);
+    candidates.insert(candidates.end(), near_new.begin(), near_new.end());
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    for (const auto& other : candidates) {
+        if (other == p) continue;
+        Point other_pos = grid_->position_of(other);
+        bool in_old = SpatialGrid::distance(other_pos, old_pos) <= view_radius_;
+        bool in_new = SpatialGrid::distance(other_pos, new_pos) <= view_radius_;
+        if (in_old && in_new) {
+            change.moved.push_back(other);
+        } else if (in_new) {
+            change.entered.push_back(other);
+        } else if (in_old) {
+            change.left.push_back(other);
         }
     }
-    map_info["players"] = players_array;
+    return change;
+}
 
-    return map_info;
+/**
+ * 관심 영역: pos 를 시야에 둔 플레이어 목록
+ * (관심 영역 비활성 시, 맵 전체 플레이어)
+ */
+std::vector<std::shared_ptr<Player>> Map::get_observers(const Point& pos) const
+{
+    if (!has_interest_management()) {
+        return get_players();
+    }
+    std::lock_guard<ProfiledMutex> lock(map_mutex_);
+    return grid_ ? grid_->query(pos, view_radius_) : get_players();
+}
+
+/**
+ * 지형 스트리밍: 장애물을 청크 단위로 분류
+ * - 청크 인덱스 = cy * chunk_cols_ + cx
+ */
+void Map::build_terrain_chunks(int chunk_size)
+{
+    chunk_obstacles_.clear();
+    chunk_size_ = chunk_size;
+    if (chunk_size <= 0) {
+        chunk_cols_ = chunk_rows_ = 0;
+        return;
+    }
+
+    chunk_cols_ = (max_width + chunk_size - 1) / chunk_size;
+    chunk_rows_ = (max_height + chunk_size - 1) / chunk_size;
+    chunk_obstacles_.resize(static_cast<std::size_t>(chunk_cols_ * chunk_rows_));
+    for (const auto& obs : obstacles_) {
+        int cx = obs.position.x / chunk_size;
+        int cy = obs.position.y / chunk_size;
+        chunk_obstacles_[cy * chunk_cols_ + cx].push_back(obs.position);
+    }
 }
 
 /**
- * 맵 내 플레이어 위치 정보를 json 배열로 반환
- * [
- *   {
- *      "player_id": "000000000001",
- *      "x": 120,
- *      "y": 45
- *   },
- *   ...
- * ]
+ * 지형 스트리밍: pos 가 속한 청크와 주변 8개 청크
+ * (맵 밖 청크는 제외)
  */
+std::vector<int> Map::get_chunks_around(const Point& pos) const
+{
+    std::vector<int> chunks;
+    if (chunk_size_ <= 0) {
+        return chunks;
+    }
 
-nlohmann::json Map::extract_players_position_info() const {
-    nlohmann::json players_json = nlohmann::json::array();
-    
-    // map_players_ 접근 시 mutex 사용 (스레드 안전하게)
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    
-    for (const auto& player_ptr : map_players_) {
-        if (player_ptr) {
-            nlohmann::json player_info;
-            player_info["player_id"] = player_ptr->id_; // 플레이어 고유 id
-            player_info["x"] = player_ptr->position_.x;  // Point 구조체의 x 값
-            player_info["y"] = player_ptr->position_.y;  // Point 구조체의 y 값
-            
-            players_json.push_back(player_info);
+    int center_x = pos.x / chunk_size_;
+    int center_y = pos.y / chunk_size_;
+    for (int cy = center_y - 1; cy <= center_y + 1; ++cy) {
+        for (int cx = center_x - 1; cx <= center_x + 1; ++cx) {
+            if (cx < 0 || cy < 0 || cx >= chunk_cols_ || cy >= chunk_rows_) continue;
+            chunks.push_back(cy * chunk_cols_ + cx);
         }
     }
-    
-    return players_json;
+    return chunks;
 }
 
 /**
- * 맵 전용 브로드캐스트
- * 해당 맵에 있는 플레이어에게 메시지 전송
+ * 지형 스트리밍: 청크 정보를 JSON으로 구성
+ * {
+ *   "chunk": 5,
+ *   "x": 8, "y": 0, "width": 8, "height": 8,
+ *   "obstacles": [ {"x":..., "y":...}, ... ]
+ * }
  */
-void Map::broadcast_in_map(const std::string& msg)
+nlohmann::json Map::extract_chunk_info(int chunk_index) const
 {
-    std::lock_guard<std::mutex> lock(map_mutex_);
-    for(auto& p : map_players_) {
-        p->send_message(msg);
+    int cx = chunk_index % chunk_cols_;
+    int cy = chunk_index / chunk_cols_;
+
+    nlohmann::json chunk_info {
+        {"chunk", chunk_index},
+        {"x", cx * chunk_size_},
+        {"y", cy * chunk_size_},
+        {"width", chunk_size_},
+        {"height", chunk_size_}
+    };
+
+    nlohmann::json obstacle_array = nlohmann::json::array();
+    for (const auto& pos : chunk_obstacles_[chunk_index]) {
+        obstacle_array.push_back({{"x", pos.x}, {"y", pos.y}});
     }
+    chunk_info["obstacles"] = obstacle_array;
+    return chunk_info;
 }
 
 /**
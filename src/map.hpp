@@ -3,10 +3,13 @@
 
 #include "point.hpp"
 #include "player.hpp"
+#include "spatial_grid.hpp"
+#include "profiled_mutex.hpp"
 #include <string>
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <memory_resource>
 #include <nlohmann/json.hpp>
 #include <random>
 
@@ -30,24 +33,50 @@ struct Obstacle {
     }
 };
 
+/**
+ * 관심 영역(AOI) 변화: 플레이어 이동 시 다른 플레이어들의 분류
+ *  - moved:   이동 전/후 모두 시야 안 → 이동 통지
+ *  - entered: 이동 후에만 시야 안    → 시야 진입 통지
+ *  - left:    이동 전에만 시야 안    → 시야 이탈 통지
+ * (체비셰프 거리는 대칭이므로, 이동한 플레이어 입장에서도 entered/left 가 그대로 적용됨)
+ */
+struct InterestChange {
+    std::vector<std::shared_ptr<Player>> moved;
+    std::vector<std::shared_ptr<Player>> entered;
+    std::vector<std::shared_ptr<Player>> left;
+};
+
 class Map : public std::enable_shared_from_this<Map> {
 public:
+    // 맵 플레이어 목록 스냅샷 (불변, 입장/퇴장 시 통째로 교체)
+    using PlayerList = std::vector<std::shared_ptr<Player>>;
+    using PlayerListPtr = std::shared_ptr<const PlayerList>;
+
     std::string name;
+    int index = 0;                 // 방 내 맵 순서 (RoomPlayerState 맵 인덱스)
     Point start_point = {-1, -1};
     Point end_point = {-1, -1};
     int max_width;
     int max_height;
 
-    // 포탈/장애물 등
-    std::vector<Portal> portals_;
-    std::vector<Obstacle> obstacles_;
+    // 메모리 풀 (방 전용 풀을 공유, nullptr 이면 기본 힙)
+    // 맵이 방보다 오래 살아남아도 풀이 먼저 해제되지 않도록 소유권 공유
+    const std::shared_ptr<std::pmr::memory_resource> arena_;
+
+    // 포탈/장애물 등 (arena_ 에서 할당)
+    std::pmr::vector<Portal> portals_;
+    std::pmr::vector<Obstacle> obstacles_;
 
     // 생성자
-    Map(const std::string& name, int width, int height);
+    Map(const std::string& name, int width, int height,
+        std::shared_ptr<std::pmr::memory_resource> arena = nullptr);
 
     bool is_end_position(const Point& pos) const;
     bool is_end_map() const;
 
+    // 난수 시드 고정 (같은 시드 → 같은 포탈/장애물, 생성 전에 호출)
+    void set_seed(uint32_t seed);
+
     // 포탈
     std::string generate_random_portal(const std::string& linked_map_name);
     bool is_portal(const Point& pos) const;
@@ -61,23 +90,55 @@ public:
     bool is_valid_position(const Point& pos) const;
 
     // 플레이어 관리
-    bool add_player(std::shared_ptr<Player> p);
+    bool add_player(std::shared_ptr<Player> p, const Point& position); // position: 관심 영역 격자 색인 위치
     bool remove_player(std::shared_ptr<Player> p);
-    std::shared_ptr<Player> find_player(const std::string& player_id);
+    std::shared_ptr<Player> find_player(SlotHandle player_handle);
     std::vector<std::shared_ptr<Player>> get_players() const;
+    PlayerListPtr get_players_snapshot() const; // 복사 없이 현재 스냅샷 참조
+
+    // 맵 정보 추출 함수 (to json, 지형만 / 플레이어 위치는 Room 이 채움)
+    // include_obstacles=false: 지형 스트리밍 모드 (장애물은 청크로 따로 전송)
+    nlohmann::json extract_map_info(bool include_obstacles = true) const;
+
+    // 지형 스트리밍: 장애물을 chunk_size 단위 청크로 분류 (장애물 생성 후 호출)
+    void build_terrain_chunks(int chunk_size);
+    bool is_terrain_streaming() const { return chunk_size_ > 0; }
+    int terrain_chunk_count() const { return chunk_cols_ * chunk_rows_; }
+
+    // 지형 스트리밍: pos 가 속한 청크와 주변 8개 청크의 인덱스
+    std::vector<int> get_chunks_around(const Point& pos) const;
+
+    // 지형 스트리밍: 청크 정보 (to json)
+    nlohmann::json extract_chunk_info(int chunk_index) const;
+
+    // 맵 내부 브로드캐스트 (exclude: 제외할 플레이어, 예: 이동한 본인)
+    void broadcast_in_map(const std::string& msg, const std::shared_ptr<Player>& exclude = nullptr);
 
-    // 맵 정보 추출 함수 (to json)
-    nlohmann::json extract_map_info() const;
+    // 관심 영역(AOI): 시야 반경 설정 (0이면 비활성 → 맵 전체 브로드캐스트)
+    // 격자는 입장/이동 시에만 색인하므로 플레이어 입장 전(방 생성 시)에 호출
+    void set_view_radius(int radius);
+    bool has_interest_management() const { return view_radius_ > 0; }
 
-    // 맵 내 모든 플레이어의 위치 정보 가져오는 함수
-    nlohmann::json extract_players_position_info() const;
+    // 관심 영역: 이동한 플레이어의 격자 위치 갱신 후, 다른 플레이어 분류
+    InterestChange update_player_interest(const std::shared_ptr<Player>& p, const Point& old_pos, const Point& new_pos);
 
-    // 맵 내부 브로드캐스트
-    void broadcast_in_map(const std::string& msg);
+    // 관심 영역: pos 를 시야에 둔 플레이어 목록
+    std::vector<std::shared_ptr<Player>> get_observers(const Point& pos) const;
 
 private:
-    mutable std::mutex map_mutex_;
-    std::vector<std::shared_ptr<Player>> map_players_;
+    // map_mutex_: 쓰기(입장/퇴장, 격자) 직렬화 용도
+    // map_players_: copy-on-write 스냅샷 → 읽기/브로드캐스트는 락 없이 atomic_load 후 순회
+    mutable ProfiledMutex map_mutex_{"map"};
+    PlayerListPtr map_players_ = std::make_shared<const PlayerList>();
+
+    int view_radius_ = 0;                // 시야 반경 (0이면 관심 영역 비활성)
+    std::unique_ptr<SpatialGrid> grid_;  // 플레이어 위치 격자 색인
+
+    // 지형 스트리밍 (맵 생성 후 변경되지 않으므로 락 불필요)
+    int chunk_size_ = 0;
+    int chunk_cols_ = 0;
+    int chunk_rows_ = 0;
+    std::pmr::vector<std::pmr::vector<Point>> chunk_obstacles_;
 
     int manhattan_distance(const Point& a, const Point& b) const;
 
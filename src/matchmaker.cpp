@@ -0,0 +1,156 @@
+#include "matchmaker.hpp"
+#include <algorithm>
+
+Matchmaker::Matchmaker(const Options& options)
+    : options_(options)
+{
+}
+
+int Matchmaker::bucket_of(int rtt_ms) const
+{
+    if (options_.rtt_bucket_ms <= 0) return 0;
+    return std::max(rtt_ms, 0) / options_.rtt_bucket_ms;
+}
+
+/**
+ * 버킷 안에서 대기 순서(등록 시각)를 유지하며 삽입
+ * (보통 뒤에서 바로 자리를 찾음)
+ */
+void Matchmaker::insert_locked(Entry entry)
+{
+    int bucket = bucket_of(entry.rtt_ms);
+    auto& queue = buckets_[bucket];
+
+    auto pos = queue.end();
+    while (pos != queue.begin() && std::prev(pos)->enqueued_at > entry.enqueued_at) {
+        --pos;
+    }
+    const Player* key = entry.player.get();
+    auto it = queue.insert(pos, std::move(entry));
+    index_[key] = Position{bucket, it};
+}
+
+bool Matchmaker::enqueue(const std::shared_ptr<Player>& player, int rtt_ms, Clock::time_point now)
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    if (index_.count(player.get())) {
+        return false;
+    }
+    insert_locked(Entry{player, now, rtt_ms});
+    return true;
+}
+
+bool Matchmaker::remove(const std::shared_ptr<Player>& player)
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    auto found = index_.find(player.get());
+    if (found == index_.end()) {
+        return false;
+    }
+    auto bucket = buckets_.find(found->second.bucket);
+    bucket->second.erase(found->second.it);
+    if (bucket->second.empty()) {
+        buckets_.erase(bucket);
+    }
+    index_.erase(found);
+    return true;
+}
+
+void Matchmaker::update_rtt(const std::shared_ptr<Player>& player, int rtt_ms)
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    auto found = index_.find(player.get());
+    if (found == index_.end()) {
+        return;
+    }
+    Position pos = found->second;
+    pos.it->rtt_ms = rtt_ms;
+    if (bucket_of(rtt_ms) == pos.bucket) {
+        return;
+    }
+
+    Entry entry = std::move(*pos.it);
+    auto bucket = buckets_.find(pos.bucket);
+    bucket->second.erase(pos.it);
+    if (bucket->second.empty()) {
+        buckets_.erase(bucket);
+    }
+    insert_locked(std::move(entry));
+}
+
+Matchmaker::Group Matchmaker::take_front_locked(Queue& queue, std::size_t count)
+{
+    Group group;
+    group.players.reserve(count);
+    group.enqueued_at.reserve(count);
+    for (std::size_t i = 0; i < count && !queue.empty(); ++i) {
+        index_.erase(queue.front().player.get());
+        group.players.push_back(std::move(queue.front().player));
+        group.enqueued_at.push_back(queue.front().enqueued_at);
+        queue.pop_front();
+    }
+    return group;
+}
+
+std::vector<Matchmaker::Group> Matchmaker::form_groups(Clock::time_point now)
+{
+    const std::size_t room_size = std::max<std::size_t>(options_.room_size, 1);
+    const std::size_t min_fill = std::clamp<std::size_t>(options_.min_fill, 1, room_size);
+    const auto max_wait = std::chrono::milliseconds(options_.max_wait_ms);
+
+    std::vector<Group> groups;
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+
+    // 1) + 2) 버킷별 편성
+    for (auto& [bucket, queue] : buckets_) {
+        while (queue.size() >= room_size) {
+            groups.push_back(take_front_locked(queue, room_size));
+        }
+        if (queue.size() >= min_fill && now - queue.front().enqueued_at >= max_wait) {
+            groups.push_back(take_front_locked(queue, queue.size()));
+        }
+    }
+
+    // 3) 버킷 간 편성: 오래 기다린 플레이어끼리 대기 순서대로
+    if (buckets_.size() > 1) {
+        std::vector<Queue::iterator> overdue;
+        for (auto& [bucket, queue] : buckets_) {
+            for (auto it = queue.begin(); it != queue.end() && now - it->enqueued_at >= max_wait; ++it) {
+                overdue.push_back(it);
+            }
+        }
+        std::sort(overdue.begin(), overdue.end(), [](const auto& a, const auto& b) {
+            return a->enqueued_at < b->enqueued_at;
+        });
+
+        std::size_t i = 0;
+        while (overdue.size() - i >= min_fill) {
+            std::size_t count = std::min(room_size, overdue.size() - i);
+            Group group;
+            group.players.reserve(count);
+            group.enqueued_at.reserve(count);
+            for (std::size_t k = 0; k < count; ++k, ++i) {
+                auto it = overdue[i];
+                auto found = index_.find(it->player.get());
+                auto& queue = buckets_[found->second.bucket];
+                index_.erase(found);
+                group.players.push_back(std::move(it->player));
+                group.enqueued_at.push_back(it->enqueued_at);
+                queue.erase(it);
+            }
+            groups.push_back(std::move(group));
+        }
+    }
+
+    // 빈 버킷 정리
+    for (auto it = buckets_.begin(); it != buckets_.end();) {
+        it = it->second.empty() ? buckets_.erase(it) : std::next(it);
+    }
+    return groups;
+}
+
+std::size_t Matchmaker::size() const
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return index_.size();
+}
@@ -0,0 +1,86 @@
+#ifndef MATCHMAKER_HPP
+#define MATCHMAKER_HPP
+
+#include "player.hpp"
+#include "profiled_mutex.hpp"
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <chrono>
+
+/**
+ * Matchmaker
+ *  - 대기열 + 방 편성 규칙
+ *  - RTT 버킷별 FIFO 대기열 (rtt_bucket_ms=0 이면 버킷 1개)
+ *  - 제거(LEFT/CLOSE)는 플레이어 → 대기열 위치 색인으로 O(1)
+ *  - form_groups() 한 번 호출에 가능한 만큼 여러 방을 편성
+ *
+ * 편성 규칙 (버킷마다):
+ *  1) room_size 명이 모이면 즉시 편성 (반복)
+ *  2) 남은 인원이 min_fill 이상이고, 가장 오래 기다린 플레이어가 max_wait_ms 이상 대기했으면 편성
+ *  3) RTT 버킷 사용 시: 버킷 안에서 편성되지 못하고 max_wait_ms 를 넘긴 플레이어끼리
+ *     버킷 구분 없이 대기 순서대로 편성
+ */
+class Matchmaker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // 편성된 방 하나: 플레이어와 각자의 대기열 등록 시각 (같은 순서)
+    // → 방 생성 실패 시 등록 시각 그대로 되돌려 대기 순서 / max_wait 경과를 잃지 않음
+    struct Group {
+        std::vector<std::shared_ptr<Player>> players;
+        std::vector<Clock::time_point> enqueued_at;
+    };
+
+    struct Options {
+        std::size_t room_size = 5;  // 방 최대 인원
+        std::size_t min_fill = 2;   // 방 편성 최소 인원
+        int max_wait_ms = 0;        // 최소 인원으로 편성하기 전 대기 시간
+        int rtt_bucket_ms = 0;      // RTT 버킷 폭 (0이면 비활성)
+    };
+
+    explicit Matchmaker(const Options& options);
+
+    // 대기열 등록 (이미 등록된 플레이어면 false)
+    // now: 등록 시각 (되돌릴 때는 원래 등록 시각을 넘기면 대기 순서에 맞는 자리로 들어감)
+    bool enqueue(const std::shared_ptr<Player>& player, int rtt_ms = 0,
+                 Clock::time_point now = Clock::now());
+
+    // 대기열에서 제거
+    bool remove(const std::shared_ptr<Player>& player);
+
+    // 측정된 RTT 반영 (버킷 이동, 대기 순서는 유지)
+    void update_rtt(const std::shared_ptr<Player>& player, int rtt_ms);
+
+    // 편성 가능한 방을 모두 편성 (편성된 플레이어는 대기열에서 제거)
+    std::vector<Group> form_groups(Clock::time_point now = Clock::now());
+
+    std::size_t size() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<Player> player;
+        Clock::time_point enqueued_at;
+        int rtt_ms = 0;
+    };
+    using Queue = std::list<Entry>;
+
+    struct Position {
+        int bucket;
+        Queue::iterator it;
+    };
+
+    int bucket_of(int rtt_ms) const;
+    void insert_locked(Entry entry);
+    Group take_front_locked(Queue& queue, std::size_t count);
+
+    const Options options_;
+    mutable ProfiledMutex mutex_{"matchmaker"};
+    std::map<int, Queue> buckets_;                      // RTT 버킷 → 대기 순서
+    std::unordered_map<const Player*, Position> index_; // 플레이어 → 대기열 위치
+};
+
+#endif // MATCHMAKER_HPP
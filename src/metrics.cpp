@@ -0,0 +1,207 @@
+#include "metrics.hpp"
+#include <sstream>
+#include <stdexcept>
+
+// ---------------------------------------------------------------------------
+// Histogram
+// ---------------------------------------------------------------------------
+
+/**
+ * 버킷 인덱스
+ * - value < 8: 값 그대로 (0~7)
+ * - 그 외: 최상위 비트 e 와 그 아래 3비트(m) → (e - 2) * 8 + m
+ *   (예: 8~15 → 8~15, 16~17 → 16, 18~19 → 17, ...)
+ */
+int Histogram::bucket_index(uint64_t value)
+{
+    if (value < static_cast<uint64_t>(kSubBuckets)) {
+        return static_cast<int>(value);
+    }
+    int e = 63 - __builtin_clzll(value);
+    if (e > kMaxExponent) {
+        return kBucketCount - 1;
+    }
+    int m = static_cast<int>((value >> (e - kSubBucketBits)) & (kSubBuckets - 1));
+    return (e - kSubBucketBits + 1) * kSubBuckets + m;
+}
+
+uint64_t Histogram::bucket_lower(int index)
+{
+    if (index < kSubBuckets) {
+        return static_cast<uint64_t>(index);
+    }
+    int e = index / kSubBuckets + kSubBucketBits - 1;
+    uint64_t m = static_cast<uint64_t>(index % kSubBuckets);
+    return (static_cast<uint64_t>(kSubBuckets) + m) << (e - kSubBucketBits);
+}
+
+uint64_t Histogram::bucket_upper(int index)
+{
+    if (index >= kBucketCount - 1) {
+        return UINT64_MAX;
+    }
+    return bucket_lower(index + 1) - 1;
+}
+
+void Histogram::record(uint64_t value)
+{
+    buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+Histogram::Snapshot Histogram::snapshot() const
+{
+    Snapshot counts;
+    for (int i = 0; i < kBucketCount; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+uint64_t Histogram::value_at_quantile(double q) const
+{
+    const Snapshot counts = snapshot();
+    uint64_t total = 0;
+    for (uint64_t c : counts) {
+        total += c;
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    q = q < 0 ? 0 : (q > 1 ? 1 : q);
+    uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total));
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return bucket_upper(i);
+        }
+    }
+    return bucket_upper(kBucketCount - 1);
+}
+
+uint64_t Histogram::count_at_or_below(uint64_t value) const
+{
+    uint64_t total = 0;
+    // value 가 속한 버킷까지 포함 (value 와 같은 기록이 빠지지 않도록)
+    for (int i = 0; i < kBucketCount && bucket_lower(i) <= value; ++i) {
+        total += buckets_[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+// ---------------------------------------------------------------------------
+// MetricsRegistry
+// ---------------------------------------------------------------------------
+
+MetricsRegistry::Family& MetricsRegistry::family(const std::string& name, Type type, const std::string& help)
+{
+    auto it = families_.find(name);
+    if (it == families_.end()) {
+        Family f;
+        f.type = type;
+        f.help = help;
+        it = families_.emplace(name, std::move(f)).first;
+    } else if (it->second.type != type) {
+        throw std::invalid_argument("metric registered with a different type: " + name);
+    }
+    return it->second;
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help, const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = family(name, Type::COUNTER, help).counters[labels];
+    if (!slot) slot = std::make_unique<Counter>();
+    return *slot;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help, const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = family(name, Type::GAUGE, help).gauges[labels];
+    if (!slot) slot = std::make_unique<Gauge>();
+    return *slot;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name, const std::string& help, const std::string& labels)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = family(name, Type::HISTOGRAM, help).histograms[labels];
+    if (!slot) slot = std::make_unique<Histogram>();
+    return *slot;
+}
+
+namespace {
+
+std::string with_labels(const std::string& name, const std::string& labels, const std::string& extra = "")
+{
+    if (labels.empty() && extra.empty()) {
+        return name;
+    }
+    std::string out = name + "{" + labels;
+    if (!labels.empty() && !extra.empty()) out += ",";
+    return out + extra + "}";
+}
+
+} // namespace
+
+/**
+ * Prometheus 텍스트 노출 형식
+ * # HELP name help
+ * # TYPE name counter|gauge|histogram
+ * name{labels} value
+ * (히스토그램: name_bucket{le="2^k 가 속한 버킷 상한"} 누적 개수, +Inf, name_sum, name_count)
+ * (누적 개수, +Inf, name_count 는 같은 버킷 스냅샷에서 계산 → 기록 중에 읽어도 le 누적 <= count)
+ */
+std::string MetricsRegistry::render_prometheus() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream out;
+
+    for (const auto& [name, f] : families_) {
+        out << "# HELP " << name << " " << f.help << "\n";
+        switch (f.type) {
+        case Type::COUNTER:
+            out << "# TYPE " << name << " counter\n";
+            for (const auto& [labels, c] : f.counters) {
+                out << with_labels(name, labels) << " " << c->value() << "\n";
+            }
+            break;
+        case Type::GAUGE:
+            out << "# TYPE " << name << " gauge\n";
+            for (const auto& [labels, g] : f.gauges) {
+                out << with_labels(name, labels) << " " << g->value() << "\n";
+            }
+            break;
+        case Type::HISTOGRAM:
+            out << "# TYPE " << name << " histogram\n";
+            for (const auto& [labels, h] : f.histograms) {
+                const Histogram::Snapshot counts = h->snapshot();
+                uint64_t cumulative = 0;
+                int i = 0;
+                for (int k = 0; k <= 26; ++k) { // 1 ~ 2^26 (약 67초, us 기준)
+                    // 실제 버킷 상한을 le 로 → 누적 개수가 근사 없이 정확 (1, 2, 4, 8, 17, 35, 71, ...)
+                    uint64_t le = Histogram::bucket_upper(Histogram::bucket_index(uint64_t{1} << k));
+                    for (; i < Histogram::kBucketCount && Histogram::bucket_lower(i) <= le; ++i) {
+                        cumulative += counts[i];
+                    }
+                    out << with_labels(name + "_bucket", labels, "le=\"" + std::to_string(le) + "\"")
+                        << " " << cumulative << "\n";
+                }
+                for (; i < Histogram::kBucketCount; ++i) {
+                    cumulative += counts[i];
+                }
+                out << with_labels(name + "_bucket", labels, "le=\"+Inf\"") << " " << cumulative << "\n";
+                out << with_labels(name + "_sum", labels) << " " << h->sum() << "\n";
+                out << with_labels(name + "_count", labels) << " " << cumulative << "\n";
+            }
+            break;
+        }
+    }
+    return out.str();
+}
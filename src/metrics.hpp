@@ -0,0 +1,118 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Counter: 단조 증가 값 (atomic, relaxed)
+ */
+class Counter {
+public:
+    void inc(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+/**
+ * Gauge: 현재 값 (증감 / 설정)
+ */
+class Gauge {
+public:
+    void set(int64_t v) { value_.store(v, std::memory_order_relaxed); }
+    void add(int64_t n) { value_.fetch_add(n, std::memory_order_relaxed); }
+    int64_t value() const { return value_.load(std::memory_order_relaxed); }
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+/**
+ * Histogram (HDR 방식 로그-선형 버킷)
+ *  - 2의 거듭제곱 구간마다 8개 하위 버킷 → 상대 오차 12.5% 이내
+ *  - 0 ~ 2^40 범위 (단위는 호출자가 결정, 보통 us)
+ *  - record 는 버킷 하나 + 합계/개수 atomic 증가만 수행 (락 없음)
+ */
+class Histogram {
+public:
+    static constexpr int kSubBucketBits = 3;
+    static constexpr int kSubBuckets = 1 << kSubBucketBits;
+    static constexpr int kMaxExponent = 40;
+    static constexpr int kBucketCount = (kMaxExponent - kSubBucketBits + 2) * kSubBuckets;
+
+    using Snapshot = std::array<uint64_t, kBucketCount>;
+
+    void record(uint64_t value);
+
+    // 버킷별 개수를 한 번에 읽음 (출력/분위수 계산이 같은 시점의 값을 쓰도록)
+    Snapshot snapshot() const;
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+
+    // q(0~1) 분위수 근사값 (버킷 상한), 기록이 없으면 0
+    uint64_t value_at_quantile(double q) const;
+
+    // value 이하 기록 수 (버킷 단위 근사: value 가 속한 버킷의 상한까지 포함)
+    uint64_t count_at_or_below(uint64_t value) const;
+
+    static int bucket_index(uint64_t value);
+    static uint64_t bucket_lower(int index);
+    static uint64_t bucket_upper(int index);
+
+private:
+    std::atomic<uint64_t> buckets_[kBucketCount] = {};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+};
+
+/**
+ * MetricsRegistry
+ *  - 이름 + 라벨별 지표 등록/조회 (등록은 잠금, 이후 갱신은 지표 객체에 직접 → 락 없음)
+ *  - 반환된 참조는 프로세스 종료까지 유효 → 호출부에서 static 참조로 캐시해 사용
+ *  - render_prometheus(): Prometheus 텍스트 노출 형식 스냅샷
+ *    (히스토그램 버킷은 2의 거듭제곱 경계로 묶어서 출력)
+ */
+class MetricsRegistry {
+public:
+    static MetricsRegistry& get_instance() {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // labels: Prometheus 라벨 본문 (예: "main_type=\"1\",sub_type=\"101\""), 없으면 ""
+    Counter& counter(const std::string& name, const std::string& help, const std::string& labels = "");
+    Gauge& gauge(const std::string& name, const std::string& help, const std::string& labels = "");
+    Histogram& histogram(const std::string& name, const std::string& help, const std::string& labels = "");
+
+    std::string render_prometheus() const;
+
+private:
+    MetricsRegistry() = default;
+
+    enum class Type { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Family {
+        Type type;
+        std::string help;
+        std::map<std::string, std::unique_ptr<Counter>> counters;     // 라벨 → 지표
+        std::map<std::string, std::unique_ptr<Gauge>> gauges;
+        std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    Family& family(const std::string& name, Type type, const std::string& help);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_; // 이름순 출력
+};
+
+#endif // METRICS_HPP
@@ -0,0 +1,53 @@
+#include "move_input_slot.hpp"
+
+MoveInputSlot::MoveInputSlot(std::size_t max_pending)
+    : max_pending_(max_pending)
+{
+}
+
+void MoveInputSlot::set_max_pending(std::size_t max_pending)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_pending_ = max_pending;
+}
+
+bool MoveInputSlot::push(RawMoveInput input)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 가득 차면 새 입력을 버림 (보관된 경로가 끊기지 않도록)
+    if (pending_.size() >= max_pending_) {
+        dropped_++;
+    } else {
+        pending_.push_back(std::move(input));
+    }
+
+    if (scheduled_ || buffer_only_) {
+        return false;
+    }
+    scheduled_ = true;
+    return true;
+}
+
+void MoveInputSlot::set_buffer_only(bool buffer_only)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_only_ = buffer_only;
+}
+
+bool MoveInputSlot::take(std::vector<RawMoveInput>& out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    out.clear();
+    if (pending_.empty()) {
+        scheduled_ = false;
+        return false;
+    }
+    out.swap(pending_);
+    return true;
+}
+
+std::size_t MoveInputSlot::dropped_count() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+}
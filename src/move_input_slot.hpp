@@ -0,0 +1,60 @@
+#ifndef MOVE_INPUT_SLOT_HPP
+#define MOVE_INPUT_SLOT_HPP
+
+#include "point.hpp"
+#include <vector>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+// 이동 입력 1개: 목표 위치 + 클라이언트 시퀀스 번호(0이면 시퀀스 미사용)
+struct MoveInput {
+    Point position;
+    uint32_t seq = 0;
+};
+
+// 슬롯에 쌓이는 원본 입력 (수신한 JSON body 그대로, 파싱은 워커에서)
+using RawMoveInput = std::vector<char>;
+
+/**
+ * MoveInputSlot
+ *  - 플레이어별 이동 입력 슬롯 (PLAYER_MOVED 병합 용도)
+ *  - 처리 대기 중인 이벤트가 이미 있으면, 새 입력은 슬롯에만 쌓고 이벤트는 만들지 않음
+ *  - io 스레드는 파싱 없이 원본만 쌓음 (파싱/검증은 핸들러가 워커에서)
+ *  - 이동은 한 칸씩만 가능하므로, 마지막 위치만 남기지 않고 경로 전체를 보관
+ *    (핸들러가 경로를 순서대로 검증하므로 치팅 불가)
+ *  - 슬롯이 가득 차면 새 입력을 버림 → 보관된 경로는 끊기지 않고 적용되고,
+ *    버린 뒤에 들어온 입력은 경로 검증에서 거절되어 클라이언트에 위치 보정 전송
+ */
+class MoveInputSlot {
+public:
+    explicit MoveInputSlot(std::size_t max_pending = 32);
+
+    // 최대 보관 입력 수 설정
+    void set_max_pending(std::size_t max_pending);
+
+    // 이동 입력 추가
+    // true: 처리 대기 중인 이벤트가 없음 → 호출자가 PLAYER_MOVED 이벤트를 enqueue 해야 함
+    // false: 이미 대기 중인 이벤트가 있음 (입력은 슬롯에 병합됨)
+    bool push(RawMoveInput input);
+
+    // 버퍼 전용 모드 (고정 스텝 시뮬레이션): push 는 항상 false, 입력은 스텝이 직접 꺼내감
+    void set_buffer_only(bool buffer_only);
+
+    // 쌓인 경로를 모두 꺼냄
+    // false: 남은 입력이 없음 → 슬롯을 "대기 이벤트 없음" 상태로 되돌림
+    bool take(std::vector<RawMoveInput>& out);
+
+    // 슬롯이 가득 차서 버린 (새) 입력 수
+    std::size_t dropped_count() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<RawMoveInput> pending_;
+    std::size_t max_pending_;
+    std::size_t dropped_ = 0;
+    bool scheduled_ = false; // PLAYER_MOVED 이벤트가 큐/워커에 있는지 여부
+    bool buffer_only_ = false; // 이벤트 없이 버퍼링만 (시뮬레이션 스텝이 소비)
+};
+
+#endif // MOVE_INPUT_SLOT_HPP
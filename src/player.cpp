@@ -1,55 +1,112 @@
 #include "player.hpp"
 #include "connection_manager.hpp"
+#include "logger.hpp"
+#include "room_usage.hpp"
 #include <cmath>
+#include <cstdio>
 
 std::atomic<uint64_t> Player::id_counter_{0};
 
 Player::Player(const std::string& name)
     : name_(name)
-    , total_distance_(0)
 {
     uint64_t new_id = id_counter_.fetch_add(1, std::memory_order_relaxed) + 1;
 
-    std::ostringstream oss;
-    oss << std::setw(12) << std::setfill('0') << new_id; // 12자리, 앞에 0 채우기
-    id_ = oss.str();
+    char buf[21];
+    std::snprintf(buf, sizeof(buf), "%012llu", static_cast<unsigned long long>(new_id)); // 12자리, 앞에 0 채우기
+    id_ = buf;
 }
 
-/**
- * 플레이어 위치 업데이트
- */
-void Player::update_position(const Point& new_position)
-{
-    position_ = new_position;
-    total_distance_++;
-}
-
-
 /**
  * 플레이어 이동 범위 확인
  * 플레이어는 한번에 1칸만 이동할 수 있음
  */
-bool Player::is_valid_position(const Point& pos) const {
+bool Player::is_valid_step(const Point& from, const Point& to) {
     // x와 y 좌표의 차이를 계산
-    int dx = std::abs(pos.x - position_.x);
-    int dy = std::abs(pos.y - position_.y);
+    int dx = std::abs(to.x - from.x);
+    int dy = std::abs(to.y - from.y);
 
     // 상하좌우 한 칸만 이동했는지 확인
     return dx + dy == 1;
 }
 
 
+/**
+ * 방 연결 (방 id + 현재 맵)
+ * - 방 입장/이탈, GAME_END, 방 정리는 이동 처리와 다른 워커에서 실행될 수 있으므로 잠금 하에서 읽고 씀
+ */
+uint64_t Player::room_id() const
+{
+    std::lock_guard<std::mutex> lock(room_mutex_);
+    return room_id_;
+}
+
+std::shared_ptr<Map> Player::current_map() const
+{
+    std::lock_guard<std::mutex> lock(room_mutex_);
+    return current_map_.lock();
+}
+
+void Player::set_room(uint64_t room_id, const std::shared_ptr<Map>& map)
+{
+    std::lock_guard<std::mutex> lock(room_mutex_);
+    room_id_ = room_id;
+    current_map_ = map;
+}
+
+void Player::set_current_map(const std::shared_ptr<Map>& map)
+{
+    std::lock_guard<std::mutex> lock(room_mutex_);
+    if (room_id_ != 0) {
+        current_map_ = map;
+    }
+}
+
+void Player::reset_room()
+{
+    {
+        std::lock_guard<std::mutex> lock(room_mutex_);
+        room_id_ = 0;
+        current_map_.reset();
+    }
+    move_slot_.set_buffer_only(false);
+    std::vector<RawMoveInput> discarded;
+    move_slot_.take(discarded);
+}
+
 /**
  * 플레이어 전용 브로드캐스트
- * 플레이어의 커넥션을 찾아, 메시지 전송
+ * 캐시된 세션 핸들로 바로 송신 큐에 넣음 (ConnectionManager 조회 없음)
  */
-void Player::send_message(const std::string& message)
+void Player::send_message(const std::string& message, std::size_t frames)
 {
-    auto conn = ConnectionManager::get_instance().get_connection_for_player(shared_from_this());
+    auto conn = get_connection();
     if(conn){
-        conn->async_write(message);
-        std::cout << "[Player:" << id_ << "] => message:" << message << std::endl;
+        RoomUsage::count_output(message.size());
+        conn->async_write(message, frames);
     } else {
-        std::cerr << "[Player:" << id_ << "] No connection found, cannot send.\n";
+        LOG_WARN("[Player:" << id_ << "] No connection found, cannot send.");
     }
 }
+
+/**
+ * 송신 세션 연결 / 해제
+ * (ConnectionManager::register_connection / unregister_connection 에서 호출)
+ */
+void Player::attach_connection(std::shared_ptr<Connection> connection)
+{
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    connection_ = connection;
+}
+
+void Player::detach_connection()
+{
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    connection_.reset();
+}
+
+std::shared_ptr<Connection> Player::get_connection() const
+{
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    return connection_.lock();
+}
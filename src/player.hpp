@@ -2,32 +2,62 @@
 #define PLAYER_HPP
 
 #include "point.hpp"
+#include "move_input_slot.hpp"
+#include "slot_map.hpp"
 #include <memory>
 #include <string>
-#include <iostream>
+#include <vector>
 #include <atomic>
-#include <sstream>
-#include <iomanip>
+#include <mutex>
 
 class Map;
+class Connection;
 
 class Player : public std::enable_shared_from_this<Player> {
 public:
-    std::string id_;
+    std::string id_;                // 외부(프로토콜) 표현용 id: 12자리 문자열
+    SlotHandle handle_;             // 내부 참조용 핸들 (ConnectionManager 등록 시 발급)
+    SlotHandle connection_handle_;  // 연결된 커넥션 슬롯 (ConnectionManager 잠금 하에서만 변경/조회)
     std::string name_;
-    int room_id_;
-    Point position_;
-    int total_distance_;
-    bool is_finished_ = false;
-    std::weak_ptr<Map> current_map_; // 현재 맵(약한 참조)
+    MoveInputSlot move_slot_;        // 처리 대기 중인 이동 입력
 
     Player(const std::string& name);
 
-    void update_position(const Point& new_position);
-    bool is_valid_position(const Point& pos) const;
-    void send_message(const std::string& message);
+    // 한 번에 상하좌우 1칸 이동인지
+    static bool is_valid_step(const Point& from, const Point& to);
+    // frames: message 에 이어붙여진 프레임 수 (OutputBatch 가 수신자별로 모아 보낼 때)
+    void send_message(const std::string& message, std::size_t frames = 1);
+
+    // 방 연결 (방 id + 현재 맵): 여러 워커가 읽고 쓰므로 room_mutex_ 하에서만 접근
+    uint64_t room_id() const;                 // 방 핸들 값 (0: 방 없음)
+    std::shared_ptr<Map> current_map() const; // 현재 맵 (방이 없거나 이미 해제됐으면 nullptr)
+    void set_room(uint64_t room_id, const std::shared_ptr<Map>& map);
+    // 맵 이동 (포탈): 그 사이 방 연결이 해제됐으면 무시
+    void set_current_map(const std::shared_ptr<Map>& map);
+
+    // 방 연결 해제 (방 이탈 / 방 생성 실패): 방 id, 현재 맵, 처리 전 이동 입력 초기화
+    // → 이후 PLAYER_MOVED 는 방을 찾지 못해 무시됨
+    void reset_room();
+
+    // 송신 세션 핸들 (ConnectionManager 등록/해제 시에만, 그 잠금 하에서 변경)
+    void attach_connection(std::shared_ptr<Connection> connection);
+    void detach_connection();
+
+    // 현재 송신 세션 (해제됐거나 커넥션이 이미 정리됐으면 nullptr)
+    std::shared_ptr<Connection> get_connection() const;
     
 private:
+    // 방 연결
+    mutable std::mutex room_mutex_;
+    uint64_t room_id_ = 0;
+    std::weak_ptr<Map> current_map_; // 약한 참조 (방/맵 수명은 GameManager 가 관리)
+
+    // 송신 세션 캐시: 전송 경로는 플레이어별 잠금 하에서 weak_ptr 만 확인 (전역 잠금 / 해시 조회 없음)
+    // - 소유하지 않음 → 해제(또는 ConnectionManager 에서 제거)된 커넥션과 버퍼는 바로 정리됨
+    // - lock() 으로 얻은 참조가 전송 중 수명을 보장
+    mutable std::mutex connection_mutex_;
+    std::weak_ptr<Connection> connection_;
+
     // 고유 id 생성을 위한 정적 카운터
     static std::atomic<uint64_t> id_counter_;
 };
@@ -0,0 +1,50 @@
+#ifndef PROBES_HPP
+#define PROBES_HPP
+
+#include <cstdint>
+
+/**
+ * USDT 정적 추적점 (provider: asio_server)
+ *  - <sys/sdt.h> 가 있으면 DTRACE_PROBEn 으로 컴파일: 추적기가 붙지 않으면 nop 명령 1개
+ *  - 없거나 -DASIO_SERVER_NO_USDT 면 아무 코드도 만들지 않음 (인자도 평가하지 않음)
+ *  - 커넥션 id 는 Connection 객체 주소 (잠금 없이 어느 스레드에서나 같은 값)
+ *
+ * 추적점 (인자)
+ *  - connection_accept (conn)
+ *  - connection_close  (conn)
+ *  - frame_received    (conn, main_type, sub_type, body_bytes)
+ *  - event_dispatch    (main_type, sub_type, trace_id, queue_depth)
+ *  - handler_start     (main_type, sub_type, trace_id)
+ *  - handler_end       (main_type, sub_type, trace_id)
+ *  - room_create       (room_id, players)
+ *  - room_end          (room_id, age_ms)
+ *  - write_complete    (conn, frames, bytes, error)   frames: 이어붙인 묶음이 아닌 프로토콜 프레임 수
+ *
+ * 예: sudo bpftrace -e 'usdt:./asio_server:asio_server:frame_received { @[arg2] = count(); }'
+ *     sudo perf probe -x ./asio_server sdt_asio_server:handler_end
+ */
+#if defined(__has_include) && !defined(ASIO_SERVER_NO_USDT)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define ASIO_SERVER_USDT 1
+#endif
+#endif
+
+#ifdef ASIO_SERVER_USDT
+#define SERVER_PROBE1(name, a1) DTRACE_PROBE1(asio_server, name, a1)
+#define SERVER_PROBE2(name, a1, a2) DTRACE_PROBE2(asio_server, name, a1, a2)
+#define SERVER_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(asio_server, name, a1, a2, a3)
+#define SERVER_PROBE4(name, a1, a2, a3, a4) DTRACE_PROBE4(asio_server, name, a1, a2, a3, a4)
+#else
+// sizeof 는 인자를 평가하지 않음 (미사용 변수 경고만 막음)
+#define SERVER_PROBE1(name, a1) do { (void)sizeof(a1); } while (0)
+#define SERVER_PROBE2(name, a1, a2) do { (void)sizeof(a1); (void)sizeof(a2); } while (0)
+#define SERVER_PROBE3(name, a1, a2, a3) do { (void)sizeof(a1); (void)sizeof(a2); (void)sizeof(a3); } while (0)
+#define SERVER_PROBE4(name, a1, a2, a3, a4) \
+    do { (void)sizeof(a1); (void)sizeof(a2); (void)sizeof(a3); (void)sizeof(a4); } while (0)
+#endif
+
+// 커넥션 id 인자 (객체 주소)
+#define PROBE_CONN_ID(conn_ptr) reinterpret_cast<uintptr_t>(conn_ptr)
+
+#endif // PROBES_HPP
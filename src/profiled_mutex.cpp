@@ -0,0 +1,128 @@
+#include "profiled_mutex.hpp"
+#include "metrics.hpp"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
+
+std::atomic<bool> ProfiledMutex::enabled_{false};
+
+namespace {
+
+// 이름 → 통계 (프로세스 종료까지 유지)
+std::mutex& stats_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+std::map<std::string, std::unique_ptr<ProfiledMutex::Stats>>& stats_map()
+{
+    static std::map<std::string, std::unique_ptr<ProfiledMutex::Stats>> m;
+    return m;
+}
+
+} // namespace
+
+ProfiledMutex::ProfiledMutex(const char* name)
+    : stats_(&stats_for(name))
+{
+}
+
+ProfiledMutex::Stats& ProfiledMutex::stats_for(const char* name)
+{
+    std::lock_guard<std::mutex> lock(stats_mutex());
+    auto& slot = stats_map()[name];
+    if (!slot) {
+        auto& reg = MetricsRegistry::get_instance();
+        const std::string labels = std::string("mutex=\"") + name + "\"";
+        slot.reset(new Stats{
+            name,
+            reg.counter("asio_server_mutex_acquisitions_total", "Profiled mutex acquisitions", labels),
+            reg.counter("asio_server_mutex_contended_total", "Profiled mutex acquisitions that had to wait", labels),
+            reg.histogram("asio_server_mutex_wait_ns", "Time spent waiting to acquire a profiled mutex", labels),
+            reg.histogram("asio_server_mutex_hold_ns", "Time a profiled mutex was held", labels),
+        });
+    }
+    return *slot;
+}
+
+int64_t ProfiledMutex::now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * 프로파일링 획득
+ * - 먼저 try_lock: 성공하면 경합 없음 (대기 0)
+ * - 실패하면 대기 시간 측정 후 경합 횟수 증가
+ */
+void ProfiledMutex::lock_profiled()
+{
+    int64_t wait = 0;
+    if (!mutex_.try_lock()) {
+        const int64_t start = now_ns();
+        mutex_.lock();
+        wait = now_ns() - start;
+        stats_->contended.inc();
+    }
+    hold_start_ns_ = now_ns();
+    stats_->acquisitions.inc();
+    stats_->wait_ns.record(static_cast<uint64_t>(wait));
+}
+
+bool ProfiledMutex::try_lock()
+{
+    if (!mutex_.try_lock()) {
+        return false;
+    }
+    if (enabled_.load(std::memory_order_relaxed)) {
+        hold_start_ns_ = now_ns();
+        stats_->acquisitions.inc();
+        stats_->wait_ns.record(0);
+    } else {
+        hold_start_ns_ = 0;
+    }
+    return true;
+}
+
+// 보유 시간은 잠금을 푼 뒤 기록 (기록 비용이 보유 시간에 포함되지 않도록)
+void ProfiledMutex::unlock_profiled()
+{
+    const int64_t held = now_ns() - hold_start_ns_;
+    hold_start_ns_ = 0;
+    mutex_.unlock();
+    stats_->hold_ns.record(static_cast<uint64_t>(held));
+}
+
+std::string ProfiledMutex::report_json()
+{
+    std::vector<const Stats*> all;
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex());
+        for (const auto& [name, stats] : stats_map()) {
+            all.push_back(stats.get());
+        }
+    }
+    std::sort(all.begin(), all.end(), [](const Stats* a, const Stats* b) {
+        return a->wait_ns.sum() > b->wait_ns.sum();
+    });
+
+    nlohmann::json locks = nlohmann::json::array();
+    for (const Stats* s : all) {
+        locks.push_back({
+            {"mutex", s->name},
+            {"acquisitions", s->acquisitions.value()},
+            {"contended", s->contended.value()},
+            {"wait_total_ns", s->wait_ns.sum()},
+            {"wait_p99_ns", s->wait_ns.value_at_quantile(0.99)},
+            {"wait_max_ns", s->wait_ns.value_at_quantile(1.0)},
+            {"hold_p50_ns", s->hold_ns.value_at_quantile(0.5)},
+            {"hold_p99_ns", s->hold_ns.value_at_quantile(0.99)}
+        });
+    }
+    return nlohmann::json{{"profiling", enabled()}, {"locks", locks}}.dump(2);
+}
@@ -0,0 +1,74 @@
+#ifndef PROFILED_MUTEX_HPP
+#define PROFILED_MUTEX_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+class Counter;
+class Histogram;
+
+/**
+ * ProfiledMutex
+ *  - std::mutex 대체용 이름 있는 뮤텍스 (Lockable: lock_guard / unique_lock / condition_variable_any 사용 가능)
+ *  - 프로파일링이 켜져 있으면 이름별로 획득 횟수, 경합 횟수, 대기 시간 / 보유 시간 히스토그램(ns) 기록
+ *    → MetricsRegistry (asio_server_mutex_*{mutex="이름"}) 로 노출
+ *  - 같은 이름의 뮤텍스(예: 방마다 있는 "room")는 통계를 공유
+ *  - 꺼져 있으면 lock/unlock 마다 atomic load 1회 + 분기만 추가
+ */
+class ProfiledMutex {
+public:
+    explicit ProfiledMutex(const char* name);
+
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    void lock() {
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            mutex_.lock();
+            hold_start_ns_ = 0;
+            return;
+        }
+        lock_profiled();
+    }
+
+    bool try_lock();
+
+    void unlock() {
+        if (hold_start_ns_ != 0) {
+            unlock_profiled();
+            return;
+        }
+        mutex_.unlock();
+    }
+
+    static void set_enabled(bool on) { enabled_.store(on, std::memory_order_relaxed); }
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    // 이름별 경합 요약 (JSON 문자열, 총 대기 시간 내림차순)
+    static std::string report_json();
+
+    struct Stats {
+        std::string name;
+        Counter& acquisitions;
+        Counter& contended;
+        Histogram& wait_ns;
+        Histogram& hold_ns;
+    };
+
+private:
+    static Stats& stats_for(const char* name);
+    static int64_t now_ns();
+
+    void lock_profiled();
+    void unlock_profiled();
+
+    static std::atomic<bool> enabled_;
+
+    Stats* stats_;
+    std::mutex mutex_;
+    int64_t hold_start_ns_ = 0; // 보유 시작 시각 (보유 중인 스레드만 접근, 0: 측정 안 함)
+};
+
+#endif // PROFILED_MUTEX_HPP
@@ -1,16 +1,62 @@
 #include "reactor.hpp"
 #include "connection.hpp"
+#include "connection_manager.hpp"
+#include "logger.hpp"
+#include "metrics.hpp"
+#include "tracer.hpp"
+#include "probes.hpp"
+#include "timer_service.hpp"
+#include <algorithm>
 
 std::unique_ptr<Reactor> Reactor::instance_ = nullptr;
 
+namespace {
+
+Gauge& queue_depth_gauge()
+{
+    static Gauge& g = MetricsRegistry::get_instance().gauge("asio_server_reactor_queue_depth", "Events waiting in the reactor queue");
+    return g;
+}
+
+/**
+ * 이벤트 생성(프레임 수신) → 핸들러 완료 지연 (us), main_type / sub_type 별
+ * - sub_type 별 히스토그램 포인터 캐시 (등록 잠금은 타입별 처음 한 번만)
+ */
+void record_event_latency(const Event& event)
+{
+    static constexpr std::size_t kMaxSubType = 400;
+    static std::atomic<Histogram*> cache[kMaxSubType] = {};
+
+    std::size_t slot = event.sub_type < kMaxSubType ? event.sub_type : 0;
+    Histogram* h = cache[slot].load(std::memory_order_acquire);
+    if (!h) {
+        std::string labels = "main_type=\"" + std::to_string(static_cast<int>(event.main_type))
+                           + "\",sub_type=\"" + (slot ? std::to_string(slot) : std::string("other")) + "\"";
+        h = &MetricsRegistry::get_instance().histogram(
+            "asio_server_event_latency_us", "Time from event creation (frame read) to handler completion", labels);
+        cache[slot].store(h, std::memory_order_release);
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - event.created_at;
+    h->record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+}
+
+} // namespace
+
 Reactor::Reactor(boost::asio::io_context& ioc, unsigned short port, ThreadPool& thread_pool, GameManager& gm)
-    : acceptor_(ioc, tcp::endpoint(tcp::v4(), port))
+    : ioc_(ioc)
+    , acceptor_(ioc, tcp::endpoint(tcp::v4(), port))
     , thread_pool_(thread_pool)
-    , ioc_(ioc)
+    , game_manager_(gm)
     , network_handler_(gm)
     , game_handler_(gm, ioc)
 {
-    std::cout << "[Reactor] Constructor - port:" << port << "\n";
+    LOG_INFO("[Reactor] Constructor - port:" << port);
+
+    // 방 타이머 만료 묶음은 리액터 큐를 거치지 않고 바로 워커로
+    TimerService::get_instance().set_event_batch_handler([this](std::vector<Event> events) {
+        enqueue_batch(std::move(events));
+    });
 }
 
 void Reactor::run() {
@@ -29,26 +75,45 @@ void Reactor::start_accept() {
 
 void Reactor::handle_accept(std::shared_ptr<tcp::socket> socket) {
     auto connection = std::make_shared<Connection>(std::move(*socket));
+    ConnectionManager::get_instance().add_connection(connection);
+    SERVER_PROBE1(connection_accept, PROBE_CONN_ID(connection.get()));
     // 이벤트가 발생하면 Reactor에게 알림
     connection->start();
 }
 
 // 이벤트 큐에서 꺼내어 처리
 void Reactor::event_loop() {
-    is_processing_ = true;
-
-    while (!event_queue_.empty()) {
-        Event event = event_queue_.front();
-        event_queue_.pop();
+    while (true) {
+        Event event;
+        std::size_t queue_depth = 0;
+        {
+            std::lock_guard<ProfiledMutex> lock(queue_mutex_);
+            if (event_queue_.empty()) {
+                is_processing_ = false;
+                return;
+            }
+            event = std::move(event_queue_.front());
+            event_queue_.pop();
+            queue_depth = event_queue_.size();
+            queue_depth_gauge().set(static_cast<int64_t>(queue_depth));
+        }
+        SERVER_PROBE4(event_dispatch, static_cast<int>(event.main_type), event.sub_type, event.trace_id, queue_depth);
 
         // 각 EventType별로 작업 스케줄링
-        std::cout << "[Reactor] event_loop called: main_type={" << (int)event.main_type << "}, sub_type={" << (int)event.sub_type << "}\n";
+        TRACE_INSTANT("dispatch", event.trace_id);
+        LOG_DEBUG("[Reactor] event_loop called: main_type={" << (int)event.main_type << "}, sub_type={" << (int)event.sub_type << "}");
         switch (event.main_type) {
         case MainEventType::NETWORK:
         {
             thread_pool_.enqueue_task([this, event]() {
                 // ThreadPool 안의 worker_thread()에서 try-catch 처리
-                network_handler_.handle_event(event);
+                SERVER_PROBE3(handler_start, static_cast<int>(event.main_type), event.sub_type, event.trace_id);
+                {
+                    TraceSpan span("network_handler", event.sub_type, event.trace_id);
+                    network_handler_.handle_event(event);
+                }
+                SERVER_PROBE3(handler_end, static_cast<int>(event.main_type), event.sub_type, event.trace_id);
+                record_event_latency(event);
             });
             break;
         }
@@ -56,7 +121,7 @@ void Reactor::event_loop() {
         {
             thread_pool_.enqueue_task([this, event]() {
                 // ThreadPool 안의 worker_thread()에서 try-catch 처리
-                game_handler_.handle_event(event);
+                run_game_event(event);
             });
             break;
         }
@@ -65,13 +130,104 @@ void Reactor::event_loop() {
             break;
         }
     }
+}
+
+void Reactor::run_game_event(const Event& event) {
+    SERVER_PROBE3(handler_start, static_cast<int>(event.main_type), event.sub_type, event.trace_id);
+    {
+        TraceSpan span("game_handler", event.sub_type, event.trace_id);
+        game_handler_.handle_event(event);
+    }
+    SERVER_PROBE3(handler_end, static_cast<int>(event.main_type), event.sub_type, event.trace_id);
+    record_event_latency(event);
+}
+
+/**
+ * 타이머 이벤트 묶음 처리 (같은 틱에 만료된 방 타이머들)
+ * - 이벤트 큐(queue_mutex_)를 거치지 않고, 방마다 작업을 만들지도 않음
+ * - 워커 수만큼의 구간으로 나눠 작업 몇 개로 넘김 (방들은 여전히 워커들에서 병렬 처리)
+ * - 한 방의 예외가 같은 구간의 다른 방을 막지 않도록 이벤트마다 try-catch
+ */
+void Reactor::enqueue_batch(std::vector<Event> events) {
+    if (events.empty()) {
+        return;
+    }
+    if (Tracer::get_instance().enabled()) {
+        for (auto& event : events) {
+            if (event.trace_id == 0) {
+                event.trace_id = Tracer::get_instance().next_trace_id();
+            }
+            TRACE_INSTANT("enqueue", event.trace_id);
+        }
+    }
 
-    is_processing_ = false;
+    auto batch = std::make_shared<const std::vector<Event>>(std::move(events));
+    std::size_t tasks = std::min(batch->size(), std::max<std::size_t>(thread_pool_.worker_count(), 1));
+    std::size_t per_task = (batch->size() + tasks - 1) / tasks;
+
+    for (std::size_t begin = 0; begin < batch->size(); begin += per_task) {
+        std::size_t end = std::min(begin + per_task, batch->size());
+        thread_pool_.enqueue_task([this, batch, begin, end]() {
+            for (std::size_t i = begin; i < end; ++i) {
+                const Event& event = (*batch)[i];
+                try {
+                    run_game_event(event);
+                } catch (const std::exception& e) {
+                    LOG_ERROR("[Reactor] timer event error: sub_type=" << event.sub_type << ", " << e.what());
+                }
+            }
+        });
+    }
 }
 
 void Reactor::enqueue_event(const Event& event) {
-    event_queue_.push(event);
-    if (!is_processing_) {
-        event_loop();
+    // PLAYER_MOVED: 이미 처리 대기 중인 이벤트가 있으면 슬롯에만 병합
+    if (event.main_type == MainEventType::GAME
+        && event.sub_type == (uint16_t)GameSubType::PLAYER_MOVED
+        && !coalesce_player_moved(event)) {
+        return;
+    }
+
+    // 추적 모드: 내부 이벤트(타이머 등)에도 trace id 발급
+    Event queued = event;
+    if (Tracer::get_instance().enabled()) {
+        if (queued.trace_id == 0) {
+            queued.trace_id = Tracer::get_instance().next_trace_id();
+        }
+        TRACE_INSTANT("enqueue", queued.trace_id);
     }
+
+    {
+        std::lock_guard<ProfiledMutex> lock(queue_mutex_);
+        event_queue_.push(std::move(queued));
+        queue_depth_gauge().set(static_cast<int64_t>(event_queue_.size()));
+        if (is_processing_) {
+            return; // 실행 중인 루프가 처리
+        }
+        is_processing_ = true;
+    }
+    event_loop();
+}
+
+/**
+ * PLAYER_MOVED 병합
+ * - 커넥션의 플레이어 입력 슬롯에 원본 body 를 쌓기만 함 (파싱/방 예산 확인은 워커의 핸들러에서)
+ * - true: 새 이벤트를 큐에 넣어야 함 / false: 대기 중인 이벤트에 병합됨 (또는 슬롯이 가득 차 버려짐)
+ * - 플레이어는 커넥션에 캐시된 것을 사용 (ConnectionManager 전역 잠금 없음)
+ * - 플레이어를 찾을 수 없으면, 그대로 핸들러로 넘겨 기존 에러 처리를 따름
+ */
+bool Reactor::coalesce_player_moved(const Event& event) {
+    if (!event.connection.has_value()) {
+        return true;
+    }
+    auto conn = event.connection->lock();
+    if (!conn) {
+        return true;
+    }
+    auto player = conn->get_player();
+    if (!player) {
+        return true;
+    }
+
+    return player->move_slot_.push(event.data);
 }
@@ -6,12 +6,14 @@
 #include <boost/asio.hpp>
 #include <memory>
 #include <queue>
+#include <mutex>
 #include <unordered_map>
 #include <functional>
 #include "event.hpp"
 #include "thread_pool.hpp"
 #include "network_event_handler.hpp"
 #include "game_event_handler.hpp"
+#include "profiled_mutex.hpp"
 
 using boost::asio::ip::tcp;
 
@@ -33,6 +35,9 @@ public:
     void run();
     void enqueue_event(const Event& event);
 
+    // 같은 타이머 틱에 만료된 GAME 이벤트 묶음 (워커 수 이하의 작업으로 나눠 처리)
+    void enqueue_batch(std::vector<Event> events);
+
 private:
     Reactor(boost::asio::io_context& ioc, unsigned short port, ThreadPool& thread_pool, GameManager& gm);
 
@@ -47,13 +52,17 @@ private:
     void start_accept();
     void handle_accept(std::shared_ptr<tcp::socket> socket);
     void event_loop();
+    void run_game_event(const Event& event);
+    bool coalesce_player_moved(const Event& event);
 
     boost::asio::io_context& ioc_;
     tcp::acceptor acceptor_;
     ThreadPool& thread_pool_;
+    GameManager& game_manager_;
     NetworkEventHandler network_handler_;
     GameEventHandler game_handler_;
 
+    ProfiledMutex queue_mutex_{"reactor_queue"}; // event_queue_ 보호 (io 스레드 + 워커 스레드에서 enqueue)
     std::queue<Event> event_queue_;
     bool is_processing_ = false; // 이벤트 루프 실행 여부 플래그
 };
@@ -1,26 +1,110 @@
 #include "room.hpp"
-#include <iostream>
+#include "logger.hpp"
+#include "tracer.hpp"
 #include <algorithm>
 
-Room::Room(int id)
+namespace {
+
+/**
+ * 방 전용 메모리 풀
+ * - unsynchronized_pool_resource + 방마다 락 하나
+ *   (synchronized_pool_resource 는 인스턴스마다 pthread key 를 하나씩 써서
+ *    PTHREAD_KEYS_MAX(1024) 개째 방부터 생성이 실패함)
+ * - 같은 방 안에서도 여러 핸들러 스레드가 할당하므로 락으로 직렬화
+ * - 풀이 소멸하면 내부 청크를 한 번에 반환 (개별 해제 없음)
+ */
+class RoomArena : public std::pmr::memory_resource {
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        return pool_.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        pool_.deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    ProfiledMutex mutex_{"room_arena"};
+    std::pmr::unsynchronized_pool_resource pool_;
+};
+
+/**
+ * 방 풀 할당자 (풀 소유권 공유)
+ * - 맵 객체 + shared_ptr 제어 블록을 방 풀에서 할당
+ * - 맵이 방보다 오래 살아남아 마지막 참조를 놓아도, 제어 블록 반환이 끝날 때까지 풀이 유지됨
+ */
+template <typename T>
+struct ArenaAllocator {
+    using value_type = T;
+
+    explicit ArenaAllocator(std::shared_ptr<std::pmr::memory_resource> arena) : arena(std::move(arena)) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* p, std::size_t n) {
+        arena->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+    std::shared_ptr<std::pmr::memory_resource> arena;
+};
+
+std::shared_ptr<std::pmr::memory_resource> make_room_arena()
+{
+    return std::make_shared<RoomArena>();
+}
+
+} // namespace
+
+Room::Room(uint64_t id)
     : id_(id)
-    , gr_(id)
+    , arena_(make_room_arena())
+    , gr_(id, arena_.get())
+    , created_at_(std::chrono::steady_clock::now())
+    , player_state_(arena_.get())
 {
-    std::cout << "[DEBUG][Room:" << id_ << "] Room constructor called.\n";
+    LOG_DEBUG("[Room:" << id_ << "] Room constructor called.");
 }
 
-void Room::initialize_maps() {
+void Room::initialize_maps(uint32_t map_seed) {
     // 맵 생성
-    auto mapA = std::make_shared<Map>("A", 10, 10);
+    // 맵 객체도 방 풀에서 할당
+    ArenaAllocator<Map> alloc(arena_);
+    auto mapA = std::allocate_shared<Map>(alloc, "A", 10, 10, arena_);
     mapA->start_point = {1, 1};
 
-    auto mapB = std::make_shared<Map>("B", 10, 10);
+    auto mapB = std::allocate_shared<Map>(alloc, "B", 10, 10, arena_);
     mapB->start_point = {1, 1};
 
-    auto mapC = std::make_shared<Map>("C", 10, 10);
+    auto mapC = std::allocate_shared<Map>(alloc, "C", 10, 10, arena_);
     mapC->start_point = {1, 1};
     mapC->end_point   = {8, 8};
 
+    // 맵 순서 (SoA 상태의 맵 인덱스)
+    mapA->index = 0;
+    mapB->index = 1;
+    mapC->index = 2;
+
+    // 고정 시드: 맵마다 다른 시드 (seed + 맵 순서)
+    if (map_seed != 0) {
+        mapA->set_seed(map_seed);
+        mapB->set_seed(map_seed + 1);
+        mapC->set_seed(map_seed + 2);
+    }
+
     // 포탈 생성
     mapA->generate_random_portal("B");
     mapB->generate_random_portal("C");
@@ -31,7 +115,7 @@ void Room::initialize_maps() {
     mapC->generate_random_obstacles(true);
 
     {
-        std::lock_guard<std::mutex> lock(room_mutex_);
+        std::lock_guard<ProfiledMutex> lock(room_mutex_);
         maps_.push_back(mapA);
         maps_.push_back(mapB);
         maps_.push_back(mapC);
@@ -44,21 +128,24 @@ void Room::initialize_maps() {
  */
 bool Room::join_player(std::shared_ptr<Player> player)
 {
-    std::lock_guard<std::mutex> lock(room_mutex_);
+    std::lock_guard<ProfiledMutex> lock(room_mutex_);
     if (maps_.empty()) {
-        std::cerr << "[Room:" << id_ << "] no maps, cannot join.\n";
+        LOG_ERROR("[Room:" << id_ << "] no maps, cannot join.");
         return false;
     }
     // 시작 맵(예: 첫 맵)
+    // 관심 영역 격자에는 시작 위치로 색인
     auto start_map = maps_[0];
-    bool ok = start_map->add_player(player);
+    bool ok = start_map->add_player(player, start_map->start_point);
     if (ok) {
-        player->current_map_ = start_map; // 플레이어 현재 맵
-        player->position_ = start_map->start_point;
-        player->room_id_ = id_;
+        player->set_room(id_, start_map); // 플레이어 방 + 현재 맵
+        {
+            std::lock_guard<ProfiledMutex> state_lock(state_mutex_);
+            player_state_.add(player, start_map->index, start_map->start_point);
+        }
         // 디버그 메시지
-        std::cout << "[Room:" << id_ << "] Player " << player->id_ << " joined start_map=" 
-                  << start_map->name << "\n";
+        LOG_DEBUG("[Room:" << id_ << "] Player " << player->id_ << " joined start_map=" 
+                  << start_map->name);
     }
     return ok;
 }
@@ -67,11 +154,11 @@ bool Room::join_player(std::shared_ptr<Player> player)
  * 방 전체에서 특정 플레이어 찾기
  * (모든 맵을 뒤져서 검색)
  */
-std::shared_ptr<Player> Room::find_player(const std::string& player_id)
+std::shared_ptr<Player> Room::find_player(SlotHandle player_handle)
 {
-    std::lock_guard<std::mutex> lock(room_mutex_);
+    std::lock_guard<ProfiledMutex> lock(room_mutex_);
     for (auto& m : maps_) {
-        auto p = m->find_player(player_id);
+        auto p = m->find_player(player_handle);
         if (p) return p;
     }
     return nullptr;
@@ -83,65 +170,159 @@ std::shared_ptr<Player> Room::find_player(const std::string& player_id)
  */
 bool Room::remove_player(std::shared_ptr<Player> player)
 {
-    std::lock_guard<std::mutex> lock(room_mutex_);
+    std::lock_guard<ProfiledMutex> lock(room_mutex_);
     bool removed = false;
     for (auto& m : maps_) {
         bool r = m->remove_player(player);
         if(r) {
-            std::cout << "[Room:" << id_ << "] Removed player " 
-                      << player->id_ << " from map " << m->name << "\n";
+            LOG_DEBUG("[Room:" << id_ << "] Removed player " 
+                      << player->id_ << " from map " << m->name);
             removed = true;
         }
     }
+
+    {
+        std::lock_guard<ProfiledMutex> state_lock(state_mutex_);
+        int index = player_state_.index_of(*player);
+        if (index >= 0) {
+            player_state_.set_active(index, false);
+        }
+    }
     return removed;
 }
 
 /**
  * 룸 내부의 모든 플레이어가 게임을 종료했는지 확인
- * (모든 맵의 플레이어 목록을 순회하여 확인)
+ * (SoA 도착 플래그 배열을 순회하여 확인, 방을 떠난 플레이어는 제외)
  */
 bool Room::is_all_players_finished() const {
-    // Room 내부의 맵 목록을 보호하기 위해 mutex 사용
-    std::lock_guard<std::mutex> lock(room_mutex_);
-    
-    // 각 Map마다 보유한 플레이어 목록에 접근하여 게임 완료 여부 검사
-    for (const auto& map_ptr : maps_) {
-        std::vector<std::shared_ptr<Player>> players = map_ptr->get_players();
-        for (const auto& player : players) {
-            // 플레이어가 존재하고, 아직 완료하지 않았다면 false 반환
-            if (player && !player->is_finished_) {
-                return false;
-            }
-        }
-    }
-    // 모든 맵의 모든 플레이어가 완료되었다면 true 반환
-    return true;
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    return player_state_.all_finished();
 }
 
 /**
  * 룸 내부의 모든 플레이어 목록 반환
- * (모든 맵의 플레이어 목록을 순회하여 확인)
+ * (도착한 플레이어 포함, 방을 떠난 플레이어는 제외)
  */
 std::vector<std::shared_ptr<Player>> Room::get_all_players() const {
-    std::vector<std::shared_ptr<Player>> all_players;
-    std::lock_guard<std::mutex> lock(room_mutex_);
-    
-    for (const auto& map_ptr : maps_) {
-        std::vector<std::shared_ptr<Player>> players = map_ptr->get_players();
-        all_players.insert(all_players.end(), players.begin(), players.end());
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    return player_state_.active_players();
+}
+
+/**
+ * 플레이어 현재 위치 조회 (입장하지 않은 플레이어: {-1, -1})
+ * - 아래 조회/반영 함수 공통: 플레이어 → 인덱스 대응은 방 상태가 보관하므로 상태 잠금 하에서 한 번만 찾아 사용
+ *   (다른 워커가 방 연결을 해제해도 인덱스가 바뀌거나 음수가 되지 않음)
+ */
+Point Room::player_position(const Player& player) const
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return {-1, -1};
+    return player_state_.position(index);
+}
+
+uint32_t Room::player_seq(const Player& player) const
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return 0;
+    return player_state_.seq(index);
+}
+
+int Room::player_distance(const Player& player) const
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return 0;
+    return player_state_.distance(index);
+}
+
+bool Room::is_player_finished(const Player& player) const
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return false;
+    return player_state_.finished(index);
+}
+
+bool Room::is_player_active(const Player& player) const
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return false;
+    return player_state_.active(index);
+}
+
+nlohmann::json Room::player_position_info(const Player& player) const
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return {{"player_id", player.id_}};
+    return player_state_.position_info(index);
+}
+
+nlohmann::json Room::players_position_info(const Map& map) const
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    return player_state_.positions_in_map(map.index);
+}
+
+/**
+ * 플레이어 이동 결과를 SoA 상태에 반영
+ */
+void Room::record_player_move(const Player& player, const Map& map, const Point& position,
+                              int steps, uint32_t seq, bool mark_dirty)
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return;
+    player_state_.move(index, map.index, position, steps, seq);
+    if (mark_dirty) {
+        player_state_.set_dirty(index);
     }
-    return all_players;
+}
+
+void Room::record_player_finished(const Player& player)
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return;
+    player_state_.set_finished(index);
+}
+
+std::vector<int> Room::take_unsent_chunks(const Player& player, const Map& map, const std::vector<int>& chunks)
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    int index = player_state_.index_of(player);
+    if (index < 0) return {};
+    return player_state_.take_unsent_chunks(index, map.index, map.terrain_chunk_count(), chunks);
+}
+
+/**
+ * 틱 모드: 맵별 변경분 스냅샷
+ */
+std::vector<RoomPlayerState::Snapshot> Room::take_dirty_snapshot(const Map& map)
+{
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    return player_state_.take_dirty(map.index);
+}
+
+std::size_t Room::present_count() const {
+    std::lock_guard<ProfiledMutex> lock(state_mutex_);
+    return player_state_.active_count();
 }
 
 /**
  * 방 전체 브로드캐스트:
- * 모든 맵에 있는 플레이어에게 메시지 전송
+ * 방에 남아있는 모든 플레이어에게 메시지 전송
+ * (도착해서 맵에서 빠진 플레이어도 GAME_END 등을 받아야 하므로 맵이 아닌 방 상태 기준)
  */
 void Room::broadcast_message(const std::string& message)
 {
-    std::lock_guard<std::mutex> lock(room_mutex_);
-    for (auto& m : maps_) {
-        m->broadcast_in_map(message);
+    TRACE_SPAN("broadcast_room", 0);
+    for (auto& p : get_all_players()) {
+        p->send_message(message);
     }
 }
 
@@ -150,7 +331,7 @@ void Room::broadcast_message(const std::string& message)
  */
 std::shared_ptr<Map> Room::get_map_by_name(const std::string& name)
 {
-    std::lock_guard<std::mutex> lock(room_mutex_);
+    std::lock_guard<ProfiledMutex> lock(room_mutex_);
     auto it = std::find_if(maps_.begin(), maps_.end(), [&](auto& mm){
         return (mm->name == name);
     });
@@ -158,6 +339,36 @@ std::shared_ptr<Map> Room::get_map_by_name(const std::string& name)
     return nullptr;
 }
 
+/**
+ * 관심 영역: 모든 맵의 시야 반경 설정
+ */
+void Room::set_view_radius(int radius)
+{
+    std::lock_guard<ProfiledMutex> lock(room_mutex_);
+    for (auto& m : maps_) {
+        m->set_view_radius(radius);
+    }
+}
+
+/**
+ * 지형 스트리밍: 모든 맵의 청크 구성
+ */
+void Room::set_terrain_chunk_size(int chunk_size)
+{
+    std::lock_guard<ProfiledMutex> lock(room_mutex_);
+    for (auto& m : maps_) {
+        m->build_terrain_chunks(chunk_size);
+    }
+}
+
+/**
+ * 룸의 모든 맵 목록 반환
+ */
+std::vector<std::shared_ptr<Map>> Room::get_maps() const
+{
+    std::lock_guard<ProfiledMutex> lock(room_mutex_);
+    return maps_; // copy
+}
 
 /**
  * 룸의 모든 맵 정보를 JSON으로 구성
@@ -170,16 +381,19 @@ std::shared_ptr<Map> Room::get_map_by_name(const std::string& name)
  *   ]
  * }
  */
-nlohmann::json Room::extract_all_map_info() const
+nlohmann::json Room::extract_all_map_info(bool include_obstacles) const
 {
     nlohmann::json j;
     j["room_id"] = id_;
 
     nlohmann::json maps_array = nlohmann::json::array();
     {
-        std::lock_guard<std::mutex> lock(room_mutex_);
+        std::lock_guard<ProfiledMutex> lock(room_mutex_);
+        std::lock_guard<ProfiledMutex> state_lock(state_mutex_);
         for(auto& m : maps_) {
-            maps_array.push_back(m->extract_map_info());
+            auto map_info = m->extract_map_info(include_obstacles);
+            map_info["players"] = player_state_.players_in_map(m->index);
+            maps_array.push_back(std::move(map_info));
         }
     }
     j["maps"] = maps_array;
@@ -4,33 +4,47 @@
 #include "map.hpp"
 #include "player.hpp"
 #include "game_result.hpp"
+#include "room_player_state.hpp"
+#include "room_usage.hpp"
+#include "profiled_mutex.hpp"
 #include <memory>
 #include <vector>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory_resource>
 #include <nlohmann/json.hpp>
 
 /**
  * Room
  *  - 여러 Map(A/B/C 등)을 보유
  *  - 플레이어 목록은 각 Map이 관리
+ *  - 플레이어 상태(위치/맵/도착/이동 거리/seq)는 방 소유 SoA 배열(RoomPlayerState)이 유일한 원본
+ *    → 이동 검증 / 도착 확인 / 틱 스냅샷 모두 여기서 읽고 씀 (상태 잠금 하에서)
+ *  - 방 전용 메모리 풀(arena_): 맵 지형/결과/상태 배열이 여기서 할당되고,
+ *    방과 맵이 모두 해제되면 풀 전체를 한 번에 반환
  *  - 방 전체에서 "플레이어 찾기 / 제거" 등의 함수 제공
+ *  - 방별 자원 사용량(usage): 핸들러 CPU / 입력 / 송신량 구간 집계 + 예산 초과 시 입력 제한
  */
 class Room : public std::enable_shared_from_this<Room> {
 public:
-    const int id_;
+    const uint64_t id_; // GameManager 방 슬롯 핸들 값
+    const std::shared_ptr<std::pmr::memory_resource> arena_; // 방 전용 메모리 풀 (gr_ 보다 먼저 초기화)
     GameResult gr_;
+    const std::chrono::steady_clock::time_point created_at_; // 방 생성 시각 (최대 게임 시간 기준)
 
-    explicit Room(int id);
+    explicit Room(uint64_t id);
 
     // 맵 초기화 (A/B/C 생성, etc.)
-    void initialize_maps();
+    // map_seed: 0 이면 무작위, 아니면 고정 시드 (같은 시드 → 같은 맵, 재현/테스트용)
+    void initialize_maps(uint32_t map_seed = 0);
 
     // 플레이어 "방 입장": 시작 맵(예: maps_[0])에 배정
     // (핸들러에서 편하게 사용)
     bool join_player(std::shared_ptr<Player> player);
 
-    // 방 전체에서 플레이어를 찾음(모든 맵 검색)
-    std::shared_ptr<Player> find_player(const std::string& player_id);
+    // 방 전체에서 플레이어를 찾음(모든 맵 검색, 핸들 비교)
+    std::shared_ptr<Player> find_player(SlotHandle player_handle);
 
     // 방 전체에서 플레이어 제거(게임에서 이탈) 
     //  -> 어떤 맵에 있는지 찾아 remove_player
@@ -42,18 +56,91 @@ public:
     // 룸의 모든 플레이어가 경기를 마무리 했는지 확인
     bool is_all_players_finished() const;
 
-    // 편의 함수: 방 전체에 broadcast (각 맵의 플레이어 전체)
+    // 방에 남아있는(접속 중인) 플레이어 수 (도착한 플레이어 포함)
+    std::size_t present_count() const;
+
+    // GAME_END 요청 표시 (처음 한 번만 true → 중복 GAME_END 방지)
+    bool mark_ending() { return !ending_.exchange(true); }
+    bool is_ending() const { return ending_.load(); }
+
+    // 플레이어 상태 조회 (SoA, 방에 입장한 플레이어만)
+    Point player_position(const Player& player) const;
+    uint32_t player_seq(const Player& player) const;     // 마지막 적용 이동 seq (0: 시퀀스 미사용)
+    int player_distance(const Player& player) const;
+    bool is_player_finished(const Player& player) const;
+    bool is_player_active(const Player& player) const; // 방에 남아있는지 (이탈하면 false)
+    nlohmann::json player_position_info(const Player& player) const; // {player_id, x, y, seq?}
+
+    // map 에 있는 플레이어 위치 목록 [{player_id, x, y}, ...]
+    nlohmann::json players_position_info(const Map& map) const;
+
+    // 플레이어 상태 반영 (SoA)
+    //  - 이동 경로 한 묶음을 한 번에: 최종 위치 + 이동 칸 수 + 마지막 적용 seq(0이면 유지)
+    //  - mark_dirty: 틱 모드에서 다음 스냅샷에 포함
+    void record_player_move(const Player& player, const Map& map, const Point& position,
+                            int steps, uint32_t seq, bool mark_dirty);
+    void record_player_finished(const Player& player);
+
+    // 지형 스트리밍: chunks 중 player 에게 아직 보내지 않은 청크만 반환하고 전송 표시
+    // (여러 핸들러가 같은 플레이어의 청크를 동시에 보내도 중복/경합 없도록 상태 잠금 하에서 처리)
+    std::vector<int> take_unsent_chunks(const Player& player, const Map& map, const std::vector<int>& chunks);
+
+    // 틱 모드: map 에서 마지막 틱 이후 이동한 플레이어 스냅샷 (변경 표시는 비움)
+    std::vector<RoomPlayerState::Snapshot> take_dirty_snapshot(const Map& map);
+
+    // 편의 함수: 방 전체에 broadcast (방에 남아있는 플레이어 전체, 도착한 플레이어 포함)
     void broadcast_message(const std::string& message);
 
     // 맵 접근
     std::shared_ptr<Map> get_map_by_name(const std::string& name);
 
+    // 맵 목록 반환 (복사)
+    std::vector<std::shared_ptr<Map>> get_maps() const;
+
     // 맵 전체 정보 추출
-    nlohmann::json extract_all_map_info() const;
+    // include_obstacles=false: 지형 스트리밍 모드 (장애물은 청크로 따로 전송)
+    nlohmann::json extract_all_map_info(bool include_obstacles = true) const;
+
+    // 지형 스트리밍: 모든 맵의 장애물을 청크로 분류 (0이면 비활성)
+    void set_terrain_chunk_size(int chunk_size);
+
+    // 틱 모드 설정 (0이면 비활성)
+    void set_tick_interval_ms(int interval_ms) { tick_interval_ms_ = interval_ms; }
+    int tick_interval_ms() const { return tick_interval_ms_; }
+    bool is_tick_mode() const { return tick_interval_ms_ > 0; }
+
+    // 고정 스텝 시뮬레이션 설정 (0이면 비활성)
+    // - 입력은 스텝마다 일괄 처리되고, 이동 결과는 스텝 끝에 스냅샷으로 전송
+    void set_simulation_step_ms(int step_ms) { simulation_step_ms_ = step_ms; }
+    int simulation_step_ms() const { return simulation_step_ms_; }
+    bool is_simulation_mode() const { return simulation_step_ms_ > 0; }
+
+    // 이동 결과를 스냅샷으로 모아서 보내는지 (틱 모드 또는 시뮬레이션 모드)
+    bool uses_snapshots() const { return is_tick_mode() || is_simulation_mode(); }
+
+    // 관심 영역: 모든 맵의 시야 반경 설정 (0이면 비활성)
+    void set_view_radius(int radius);
+
+    // 다음 틱 번호 발급
+    uint64_t next_tick() { return ++tick_; }
+
+    // 방별 자원 사용량 / 예산
+    RoomUsage& usage() { return usage_; }
+    const RoomUsage& usage() const { return usage_; }
 
 private:
     std::vector<std::shared_ptr<Map>> maps_;
-    mutable std::mutex room_mutex_; // protect maps_ if needed
+    mutable ProfiledMutex room_mutex_{"room"}; // protect maps_ if needed
+
+    RoomPlayerState player_state_;   // 방 소유 플레이어 상태 (SoA)
+    mutable ProfiledMutex state_mutex_{"room_state"}; // protect player_state_
+
+    int tick_interval_ms_ = 0;      // 틱 간격(ms), 0이면 즉시 브로드캐스트
+    int simulation_step_ms_ = 0;    // 시뮬레이션 스텝 간격(ms), 0이면 입력마다 처리
+    std::atomic<uint64_t> tick_{0}; // 마지막으로 발급한 틱 번호
+    std::atomic<bool> ending_{false}; // GAME_END 요청 여부
+
+    RoomUsage usage_;               // 자원 사용량 (CPU / 입력 / 송신)
 };
 
 #endif // ROOM_HPP
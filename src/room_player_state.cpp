@@ -0,0 +1,200 @@
+#include "room_player_state.hpp"
+
+RoomPlayerState::RoomPlayerState(std::pmr::memory_resource* resource)
+    : x_(resource)
+    , y_(resource)
+    , distance_(resource)
+    , seq_(resource)
+    , map_index_(resource)
+    , finished_(resource)
+    , dirty_(resource)
+    , active_(resource)
+    , ids_(resource)
+    , players_(resource)
+    , sent_chunks_(resource)
+    , index_(resource)
+{
+}
+
+int RoomPlayerState::add(const std::shared_ptr<Player>& player, int map_index, const Point& position)
+{
+    int index = static_cast<int>(players_.size());
+    x_.push_back(position.x);
+    y_.push_back(position.y);
+    distance_.push_back(0);
+    seq_.push_back(0);
+    map_index_.push_back(static_cast<uint8_t>(map_index));
+    finished_.push_back(0);
+    dirty_.push_back(0);
+    active_.push_back(1);
+    ids_.emplace_back(player->id_);
+    players_.push_back(player);
+    sent_chunks_.emplace_back();
+    index_[player.get()] = index;
+    return index;
+}
+
+int RoomPlayerState::index_of(const Player& player) const
+{
+    auto it = index_.find(&player);
+    return it != index_.end() ? it->second : -1;
+}
+
+void RoomPlayerState::move(int index, int map_index, const Point& position, int steps, uint32_t seq)
+{
+    x_[index] = position.x;
+    y_[index] = position.y;
+    distance_[index] += steps;
+    if (seq > 0) {
+        seq_[index] = seq;
+    }
+    map_index_[index] = static_cast<uint8_t>(map_index);
+}
+
+/**
+ * 위치 정보
+ * - seq: 마지막 적용 이동 시퀀스 (시퀀스를 보낸 클라이언트만, 본인에게는 ack)
+ * { "player_id": "000000000001", "x": 3, "y": 4, "seq": 17 }
+ */
+nlohmann::json RoomPlayerState::position_info(int index) const
+{
+    nlohmann::json info {
+        {"player_id", std::string(ids_[index])},
+        {"x", x_[index]},
+        {"y", y_[index]}
+    };
+    if (seq_[index] > 0) {
+        info["seq"] = seq_[index];
+    }
+    return info;
+}
+
+nlohmann::json RoomPlayerState::positions_in_map(int map_index) const
+{
+    nlohmann::json result = nlohmann::json::array();
+    const std::size_t n = map_index_.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        if (map_index_[i] != map_index || !active_[i] || finished_[i]) {
+            continue;
+        }
+        result.push_back({
+            {"player_id", std::string(ids_[i])},
+            {"x", x_[i]},
+            {"y", y_[i]}
+        });
+    }
+    return result;
+}
+
+nlohmann::json RoomPlayerState::players_in_map(int map_index) const
+{
+    nlohmann::json result = nlohmann::json::array();
+    const std::size_t n = map_index_.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        if (map_index_[i] != map_index || !active_[i] || finished_[i]) {
+            continue;
+        }
+        result.push_back({
+            {"id", std::string(ids_[i])},
+            {"name", players_[i]->name_},
+            {"position", {{"x", x_[i]}, {"y", y_[i]}}}
+        });
+    }
+    return result;
+}
+
+void RoomPlayerState::set_finished(int index)
+{
+    finished_[index] = 1;
+}
+
+void RoomPlayerState::set_dirty(int index)
+{
+    dirty_[index] = 1;
+}
+
+void RoomPlayerState::set_active(int index, bool active)
+{
+    active_[index] = active ? 1 : 0;
+}
+
+/**
+ * 남아있는 플레이어 중 도착하지 않은 플레이어가 있는지
+ * (분기 없이 누적 → 컴파일러 벡터화 대상)
+ */
+bool RoomPlayerState::all_finished() const
+{
+    unsigned pending = 0;
+    const std::size_t n = active_.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        pending += active_[i] & (finished_[i] ^ 1u);
+    }
+    return pending == 0;
+}
+
+/**
+ * 틱 스냅샷: 해당 맵에서 이동한 플레이어만 수집
+ * - 도착했거나 방을 떠난 플레이어는 제외 (별도 통지)
+ */
+std::vector<RoomPlayerState::Snapshot> RoomPlayerState::take_dirty(int map_index)
+{
+    std::vector<Snapshot> result;
+    const std::size_t n = dirty_.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!dirty_[i] || map_index_[i] != map_index) {
+            continue;
+        }
+        dirty_[i] = 0;
+        if (!active_[i] || finished_[i]) {
+            continue;
+        }
+
+        Snapshot snap;
+        snap.position = {x_[i], y_[i]};
+        snap.info = position_info(static_cast<int>(i));
+        result.push_back(std::move(snap));
+    }
+    return result;
+}
+
+std::vector<int> RoomPlayerState::take_unsent_chunks(int index, int map_index, int chunk_count,
+                                                     const std::vector<int>& chunks)
+{
+    auto& per_map = sent_chunks_[index];
+    if (per_map.size() <= static_cast<std::size_t>(map_index)) {
+        per_map.resize(static_cast<std::size_t>(map_index) + 1);
+    }
+    auto& sent = per_map[map_index];
+    if (sent.size() < static_cast<std::size_t>(chunk_count)) {
+        sent.resize(static_cast<std::size_t>(chunk_count), 0);
+    }
+
+    std::vector<int> result;
+    for (int chunk : chunks) {
+        if (sent[chunk]) continue;
+        sent[chunk] = 1;
+        result.push_back(chunk);
+    }
+    return result;
+}
+
+std::size_t RoomPlayerState::active_count() const
+{
+    std::size_t count = 0;
+    for (auto active : active_) {
+        count += active;
+    }
+    return count;
+}
+
+std::vector<std::shared_ptr<Player>> RoomPlayerState::active_players() const
+{
+    std::vector<std::shared_ptr<Player>> result;
+    result.reserve(players_.size());
+    for (std::size_t i = 0; i < players_.size(); ++i) {
+        if (active_[i]) {
+            result.push_back(players_[i]);
+        }
+    }
+    return result;
+}
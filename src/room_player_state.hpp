@@ -0,0 +1,97 @@
+#ifndef ROOM_PLAYER_STATE_HPP
+#define ROOM_PLAYER_STATE_HPP
+
+#include "point.hpp"
+#include "player.hpp"
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+/**
+ * RoomPlayerState
+ *  - 방 소유 플레이어 상태 (SoA: 필드별 연속 배열)
+ *  - 게임 중 위치/맵/이동 거리/도착/seq 의 유일한 저장소 (Player 객체에는 사본이 없음)
+ *  - 인덱스: 입장 순서 (방이 살아있는 동안 고정), 플레이어 → 인덱스 대응도 여기서만 보관 (index_of)
+ *  - 도착 확인 / 틱 스냅샷처럼 방 전체를 훑는 처리는 배열을 순서대로 도는 루프로 처리
+ *  - 내부 동기화 없음 (Room 이 잠금 관리)
+ */
+class RoomPlayerState {
+public:
+    // resource: 배열 할당 풀 (방 전용 풀)
+    explicit RoomPlayerState(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    // 틱 스냅샷 항목 (관심 영역 관찰자 조회용 위치 포함)
+    struct Snapshot {
+        Point position;
+        nlohmann::json info; // {player_id, x, y, seq?}
+    };
+
+    // 플레이어 추가 후 인덱스 반환 (position: 시작 위치)
+    int add(const std::shared_ptr<Player>& player, int map_index, const Point& position);
+
+    // 플레이어의 인덱스 (입장하지 않은 플레이어: -1, 이탈한 플레이어도 행은 남아있음)
+    int index_of(const Player& player) const;
+
+    // 이동 적용: 위치/맵 갱신, 이동 거리 += steps, seq 는 0이 아닐 때만 갱신
+    void move(int index, int map_index, const Point& position, int steps, uint32_t seq);
+
+    Point position(int index) const { return {x_[index], y_[index]}; }
+    int map_index(int index) const { return map_index_[index]; }
+    int distance(int index) const { return distance_[index]; }
+    uint32_t seq(int index) const { return seq_[index]; }
+    bool finished(int index) const { return finished_[index] != 0; }
+    bool active(int index) const { return active_[index] != 0; }
+
+    // 위치 정보 {player_id, x, y, seq?} (스냅샷 / 시야 진입 항목)
+    nlohmann::json position_info(int index) const;
+
+    // map_index 맵에 있는(남아있고 도착하지 않은) 플레이어
+    //  - positions_in_map: [{player_id, x, y}, ...] (맵 입장 통지)
+    //  - players_in_map:   [{id, name, position: {x, y}}, ...] (방 생성 정보)
+    nlohmann::json positions_in_map(int map_index) const;
+    nlohmann::json players_in_map(int map_index) const;
+
+    void set_finished(int index);
+    void set_dirty(int index);
+    void set_active(int index, bool active);
+
+    // 방에 남아있는(active) 플레이어가 모두 도착했는지
+    bool all_finished() const;
+
+    // 틱 모드: map_index 맵에서 마지막 틱 이후 이동한 플레이어 스냅샷 (변경 표시는 비움)
+    std::vector<Snapshot> take_dirty(int map_index);
+
+    // 지형 스트리밍: chunks 중 index 플레이어에게 아직 보내지 않은 청크만 반환하고 전송 표시
+    //  - chunk_count: map_index 맵의 전체 청크 수
+    std::vector<int> take_unsent_chunks(int index, int map_index, int chunk_count, const std::vector<int>& chunks);
+
+    // 방에 남아있는 플레이어 목록
+    std::vector<std::shared_ptr<Player>> active_players() const;
+
+    std::size_t size() const { return players_.size(); }
+
+    // 방에 남아있는(active) 플레이어 수
+    std::size_t active_count() const;
+
+private:
+    std::pmr::vector<int32_t> x_;
+    std::pmr::vector<int32_t> y_;
+    std::pmr::vector<int32_t> distance_;
+    std::pmr::vector<uint32_t> seq_;
+    std::pmr::vector<uint8_t> map_index_;
+    std::pmr::vector<uint8_t> finished_;
+    std::pmr::vector<uint8_t> dirty_;
+    std::pmr::vector<uint8_t> active_;
+
+    // 스냅샷/전송용 (핫 루프에서는 접근하지 않음)
+    std::pmr::vector<std::pmr::string> ids_;
+    std::pmr::vector<std::shared_ptr<Player>> players_;
+    std::pmr::vector<std::pmr::vector<std::pmr::vector<uint8_t>>> sent_chunks_; // [플레이어][맵] 전송한 지형 청크
+    std::pmr::unordered_map<const Player*, int> index_; // 플레이어 → 인덱스
+};
+
+#endif // ROOM_PLAYER_STATE_HPP
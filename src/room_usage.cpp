@@ -0,0 +1,157 @@
+#include "room_usage.hpp"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+
+namespace {
+
+thread_local RoomUsage::Scope* current_scope = nullptr;
+
+// 현재 스레드 CPU 시간 (ns)
+uint64_t thread_cpu_ns()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+} // namespace
+
+int64_t RoomUsage::now_ms()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RoomUsage::set_budget(const Budget& budget)
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    budget_ = budget;
+    slot_ms_ = std::max<int64_t>(budget_.window_ms / kSlots, 1);
+    for (auto& s : slots_) {
+        s = Slot{};
+    }
+}
+
+RoomUsage::Budget RoomUsage::budget() const
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return budget_;
+}
+
+void RoomUsage::accumulate(Totals& into, const Totals& from)
+{
+    into.cpu_us += from.cpu_us;
+    into.msgs_in += from.msgs_in;
+    into.bytes_in += from.bytes_in;
+    into.msgs_out += from.msgs_out;
+    into.bytes_out += from.bytes_out;
+}
+
+// now_ms 가 속한 칸 (지난 구간의 칸이면 비우고 재사용), 잠금 하에서 호출
+RoomUsage::Slot& RoomUsage::slot_at(int64_t now_ms)
+{
+    int64_t epoch = now_ms / slot_ms_;
+    Slot& s = slots_[epoch % kSlots];
+    if (s.epoch != epoch) {
+        s = Slot{};
+        s.epoch = epoch;
+    }
+    return s;
+}
+
+// 최근 kSlots 칸 합계, 잠금 하에서 호출
+RoomUsage::Totals RoomUsage::sum_window(int64_t now_ms) const
+{
+    int64_t epoch = now_ms / slot_ms_;
+    Totals sum;
+    for (const auto& s : slots_) {
+        if (s.epoch >= 0 && s.epoch > epoch - kSlots && s.epoch <= epoch) {
+            accumulate(sum, s.totals);
+        }
+    }
+    return sum;
+}
+
+RoomUsage::Totals RoomUsage::window_totals(int64_t now_ms) const
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return sum_window(now_ms);
+}
+
+RoomUsage::Totals RoomUsage::lifetime_totals() const
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return lifetime_;
+}
+
+// 구간 합계가 예산 중 하나라도 넘었는지, 잠금 하에서 호출
+bool RoomUsage::over_budget(int64_t now_ms) const
+{
+    Totals sum = sum_window(now_ms);
+    return (budget_.cpu_ms > 0 && sum.cpu_us > budget_.cpu_ms * 1000)
+        || (budget_.msgs_in > 0 && sum.msgs_in > budget_.msgs_in)
+        || (budget_.bytes_out > 0 && sum.bytes_out > budget_.bytes_out);
+}
+
+/**
+ * 수신 입력 반영
+ * - 버려질 입력도 수신량에는 포함 (어느 방이 몰아 보내는지 보이도록)
+ * - 예산을 넘긴 동안은 false → 구간이 지나 사용량이 내려가면 다시 허용
+ */
+bool RoomUsage::admit_input(std::size_t bytes, int64_t now_ms)
+{
+    bool over;
+    {
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        Slot& s = slot_at(now_ms);
+        s.totals.msgs_in += 1;
+        s.totals.bytes_in += bytes;
+        lifetime_.msgs_in += 1;
+        lifetime_.bytes_in += bytes;
+        over = over_budget(now_ms);
+    }
+    throttled_.store(over, std::memory_order_relaxed);
+    if (over) {
+        throttled_inputs_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return !over;
+}
+
+void RoomUsage::add_handler(uint64_t cpu_ns, uint64_t msgs_out, uint64_t bytes_out, int64_t now_ms)
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    Totals delta;
+    delta.cpu_us = cpu_ns / 1000;
+    delta.msgs_out = msgs_out;
+    delta.bytes_out = bytes_out;
+    accumulate(slot_at(now_ms).totals, delta);
+    accumulate(lifetime_, delta);
+}
+
+RoomUsage::Scope::Scope(RoomUsage* usage)
+    : usage_(usage)
+    , prev_(current_scope)
+{
+    if (usage_) {
+        start_cpu_ns_ = thread_cpu_ns();
+        current_scope = this;
+    }
+}
+
+RoomUsage::Scope::~Scope()
+{
+    if (!usage_) {
+        return;
+    }
+    current_scope = prev_;
+    usage_->add_handler(thread_cpu_ns() - start_cpu_ns_, msgs_out_, bytes_out_);
+}
+
+void RoomUsage::count_output(std::size_t bytes)
+{
+    if (current_scope) {
+        current_scope->msgs_out_ += 1;
+        current_scope->bytes_out_ += bytes;
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef ROOM_USAGE_HPP
+#define ROOM_USAGE_HPP
+
+#include "profiled_mutex.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * RoomUsage
+ *  - 방별 자원 사용량 집계: 핸들러 CPU 시간, 수신 입력 수/바이트, 송신 메시지 수/바이트
+ *  - 최근 window_ms 구간 합계 (kSlots 칸 링, 칸이 지나가면 재사용) + 누적 합계
+ *  - 예산(0이면 제한 없음)을 넘긴 방은 throttled → 호출자가 입력을 버림
+ *  - 송신은 Scope 구간(해당 방 핸들러 실행 중)에 보낸 메시지를 모아 한 번에 반영
+ */
+class RoomUsage {
+public:
+    static constexpr int kSlots = 10;
+
+    struct Totals {
+        uint64_t cpu_us = 0;
+        uint64_t msgs_in = 0;
+        uint64_t bytes_in = 0;
+        uint64_t msgs_out = 0;
+        uint64_t bytes_out = 0;
+    };
+
+    // 구간(window_ms)당 예산, 0이면 제한 없음
+    struct Budget {
+        int window_ms = 10000;
+        uint64_t cpu_ms = 0;
+        uint64_t msgs_in = 0;
+        uint64_t bytes_out = 0;
+    };
+
+    RoomUsage() = default;
+
+    RoomUsage(const RoomUsage&) = delete;
+    RoomUsage& operator=(const RoomUsage&) = delete;
+
+    // 예산/구간 설정 (구간 집계는 비움)
+    void set_budget(const Budget& budget);
+    Budget budget() const;
+
+    // 수신 입력 1개 반영 후 허용 여부 반환 (false: 예산 초과로 버려야 함)
+    bool admit_input(std::size_t bytes) { return admit_input(bytes, now_ms()); }
+    bool admit_input(std::size_t bytes, int64_t now_ms);
+
+    void add_handler(uint64_t cpu_ns, uint64_t msgs_out, uint64_t bytes_out) {
+        add_handler(cpu_ns, msgs_out, bytes_out, now_ms());
+    }
+    void add_handler(uint64_t cpu_ns, uint64_t msgs_out, uint64_t bytes_out, int64_t now_ms);
+
+    Totals window_totals() const { return window_totals(now_ms()); }
+    Totals window_totals(int64_t now_ms) const;
+    Totals lifetime_totals() const;
+
+    bool throttled() const { return throttled_.load(std::memory_order_relaxed); }
+    uint64_t throttled_inputs() const { return throttled_inputs_.load(std::memory_order_relaxed); }
+
+    static int64_t now_ms();
+
+    /**
+     * Scope: 한 방의 핸들러 실행 구간 (RAII)
+     *  - 스레드 CPU 시간 측정, 구간 동안 보낸 메시지를 모아 소멸 시 반영
+     *  - usage 가 nullptr 이면 아무것도 하지 않음 (중첩 시 바깥 구간 복원)
+     */
+    class Scope {
+    public:
+        explicit Scope(RoomUsage* usage);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        friend class RoomUsage;
+        RoomUsage* usage_;
+        Scope* prev_;
+        uint64_t start_cpu_ns_ = 0;
+        uint64_t msgs_out_ = 0;
+        uint64_t bytes_out_ = 0;
+    };
+
+    // 현재 스레드의 Scope 에 송신 1건 반영 (구간 밖이면 무시)
+    static void count_output(std::size_t bytes);
+
+private:
+    struct Slot {
+        int64_t epoch = -1; // 칸 번호 (now_ms / slot_ms), 다르면 지난 구간
+        Totals totals;
+    };
+
+    Slot& slot_at(int64_t now_ms);
+    Totals sum_window(int64_t now_ms) const;
+    bool over_budget(int64_t now_ms) const;
+    static void accumulate(Totals& into, const Totals& from);
+
+    mutable ProfiledMutex mutex_{"room_usage"};
+    Budget budget_;
+    int64_t slot_ms_ = budget_.window_ms / kSlots;
+    Slot slots_[kSlots];
+    Totals lifetime_;
+
+    std::atomic<bool> throttled_{false};
+    std::atomic<uint64_t> throttled_inputs_{0};
+};
+
+#endif // ROOM_USAGE_HPP
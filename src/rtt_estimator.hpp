@@ -0,0 +1,42 @@
+#ifndef RTT_ESTIMATOR_HPP
+#define RTT_ESTIMATOR_HPP
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * RttEstimator
+ *  - 커넥션별 왕복 지연(RTT) 이동 평균 (RFC 6298 방식)
+ *  - srtt:   지수 가중 평균 (새 샘플 가중치 1/8)
+ *  - rttvar: 평균 편차 (새 샘플 가중치 1/4)
+ *  - 내부 동기화 없음 (소유자가 잠금 관리)
+ */
+class RttEstimator {
+public:
+    void add_sample(double rtt_ms) {
+        if (rtt_ms < 0) rtt_ms = 0;
+        if (samples_ == 0) {
+            srtt_ms_ = rtt_ms;
+            rttvar_ms_ = rtt_ms / 2;
+        } else {
+            rttvar_ms_ = 0.75 * rttvar_ms_ + 0.25 * std::fabs(srtt_ms_ - rtt_ms);
+            srtt_ms_ = 0.875 * srtt_ms_ + 0.125 * rtt_ms;
+        }
+        last_ms_ = rtt_ms;
+        ++samples_;
+    }
+
+    bool has_sample() const { return samples_ > 0; }
+    uint64_t sample_count() const { return samples_; }
+    double srtt_ms() const { return srtt_ms_; }
+    double rttvar_ms() const { return rttvar_ms_; }
+    double last_ms() const { return last_ms_; }
+
+private:
+    double srtt_ms_ = 0;
+    double rttvar_ms_ = 0;
+    double last_ms_ = 0;
+    uint64_t samples_ = 0;
+};
+
+#endif // RTT_ESTIMATOR_HPP
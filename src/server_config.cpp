@@ -0,0 +1,126 @@
+#include "server_config.hpp"
+#include <fstream>
+#include <stdexcept>
+
+/**
+ * JSON 설정 파일 읽기
+ * {
+ *   "port": 12345,
+ *   "tick_interval_ms": 50,
+ *   "max_pending_moves": 32,
+ *   "view_radius": 0,
+ *   "terrain_chunk_size": 0,
+ *   "map_seed": 0,
+ *   "matchmaking_interval_ms": 100,
+ *   "room_size": 5,
+ *   "min_room_fill": 2,
+ *   "matchmaking_max_wait_ms": 0,
+ *   "matchmaking_rtt_bucket_ms": 0,
+ *   "timer_resolution_ms": 10,
+ *   "simulation_step_ms": 0,
+ *   "max_game_duration_ms": 0,
+ *   "room_reap_interval_ms": 1000,
+ *   "room_reap_batch": 64,
+ *   "room_budget_window_ms": 10000,
+ *   "room_cpu_budget_ms": 0,
+ *   "room_input_budget": 0,
+ *   "room_output_budget_bytes": 0,
+ *   "heartbeat_interval_ms": 0,
+ *   "idle_timeout_ms": 0,
+ *   "log_level": "info",
+ *   "log_file": "",
+ *   "metrics_file": "",
+ *   "metrics_dump_interval_ms": 10000,
+ *   "admin_port": 0,
+ *   "trace_enabled": false,
+ *   "trace_buffer_spans": 16384,
+ *   "mutex_profiling": false,
+ *   "cpu_profile_file": "cpu.prof",
+ *   "cpu_profile_seconds": 10,
+ *   "cpu_profile_hz": 100
+ * }
+ */
+ServerConfig ServerConfig::load_from_file(const std::string& path)
+{
+    std::ifstream ifs(path);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("설정 파일을 열 수 없습니다: " + path);
+    }
+
+    nlohmann::json j = nlohmann::json::parse(ifs);
+
+    ServerConfig config;
+    config.port = j.value("port", config.port);
+    config.tick_interval_ms = j.value("tick_interval_ms", config.tick_interval_ms);
+    config.max_pending_moves = j.value("max_pending_moves", config.max_pending_moves);
+    config.view_radius = j.value("view_radius", config.view_radius);
+    config.terrain_chunk_size = j.value("terrain_chunk_size", config.terrain_chunk_size);
+    config.map_seed = j.value("map_seed", config.map_seed);
+    config.matchmaking_interval_ms = j.value("matchmaking_interval_ms", config.matchmaking_interval_ms);
+    config.room_size = j.value("room_size", config.room_size);
+    config.min_room_fill = j.value("min_room_fill", config.min_room_fill);
+    config.matchmaking_max_wait_ms = j.value("matchmaking_max_wait_ms", config.matchmaking_max_wait_ms);
+    config.matchmaking_rtt_bucket_ms = j.value("matchmaking_rtt_bucket_ms", config.matchmaking_rtt_bucket_ms);
+    config.timer_resolution_ms = j.value("timer_resolution_ms", config.timer_resolution_ms);
+    config.simulation_step_ms = j.value("simulation_step_ms", config.simulation_step_ms);
+    config.max_game_duration_ms = j.value("max_game_duration_ms", config.max_game_duration_ms);
+    config.room_reap_interval_ms = j.value("room_reap_interval_ms", config.room_reap_interval_ms);
+    config.room_reap_batch = j.value("room_reap_batch", config.room_reap_batch);
+    config.room_budget_window_ms = j.value("room_budget_window_ms", config.room_budget_window_ms);
+    config.room_cpu_budget_ms = j.value("room_cpu_budget_ms", config.room_cpu_budget_ms);
+    config.room_input_budget = j.value("room_input_budget", config.room_input_budget);
+    config.room_output_budget_bytes = j.value("room_output_budget_bytes", config.room_output_budget_bytes);
+    config.heartbeat_interval_ms = j.value("heartbeat_interval_ms", config.heartbeat_interval_ms);
+    config.idle_timeout_ms = j.value("idle_timeout_ms", config.idle_timeout_ms);
+    config.log_level = j.value("log_level", config.log_level);
+    config.log_file = j.value("log_file", config.log_file);
+    config.metrics_file = j.value("metrics_file", config.metrics_file);
+    config.metrics_dump_interval_ms = j.value("metrics_dump_interval_ms", config.metrics_dump_interval_ms);
+    config.admin_port = j.value("admin_port", config.admin_port);
+    config.trace_enabled = j.value("trace_enabled", config.trace_enabled);
+    config.trace_buffer_spans = j.value("trace_buffer_spans", config.trace_buffer_spans);
+    config.mutex_profiling = j.value("mutex_profiling", config.mutex_profiling);
+    config.cpu_profile_file = j.value("cpu_profile_file", config.cpu_profile_file);
+    config.cpu_profile_seconds = j.value("cpu_profile_seconds", config.cpu_profile_seconds);
+    config.cpu_profile_hz = j.value("cpu_profile_hz", config.cpu_profile_hz);
+    return config;
+}
+
+nlohmann::json ServerConfig::to_json() const
+{
+    return {
+        {"port", port},
+        {"tick_interval_ms", tick_interval_ms},
+        {"max_pending_moves", max_pending_moves},
+        {"view_radius", view_radius},
+        {"terrain_chunk_size", terrain_chunk_size},
+        {"map_seed", map_seed},
+        {"matchmaking_interval_ms", matchmaking_interval_ms},
+        {"room_size", room_size},
+        {"min_room_fill", min_room_fill},
+        {"matchmaking_max_wait_ms", matchmaking_max_wait_ms},
+        {"matchmaking_rtt_bucket_ms", matchmaking_rtt_bucket_ms},
+        {"timer_resolution_ms", timer_resolution_ms},
+        {"simulation_step_ms", simulation_step_ms},
+        {"max_game_duration_ms", max_game_duration_ms},
+        {"room_reap_interval_ms", room_reap_interval_ms},
+        {"room_reap_batch", room_reap_batch},
+        {"room_budget_window_ms", room_budget_window_ms},
+        {"room_cpu_budget_ms", room_cpu_budget_ms},
+        {"room_input_budget", room_input_budget},
+        {"room_output_budget_bytes", room_output_budget_bytes},
+        {"heartbeat_interval_ms", heartbeat_interval_ms},
+        {"idle_timeout_ms", idle_timeout_ms},
+        {"log_level", log_level},
+        {"log_file", log_file},
+        {"metrics_file", metrics_file},
+        {"metrics_dump_interval_ms", metrics_dump_interval_ms},
+        {"admin_port", admin_port},
+        {"trace_enabled", trace_enabled},
+        {"trace_buffer_spans", trace_buffer_spans},
+        {"mutex_profiling", mutex_profiling},
+        {"cpu_profile_file", cpu_profile_file},
+        {"cpu_profile_seconds", cpu_profile_seconds},
+        {"cpu_profile_hz", cpu_profile_hz}
+    };
+}
@@ -0,0 +1,118 @@
+#ifndef SERVER_CONFIG_HPP
+#define SERVER_CONFIG_HPP
+
+#include <string>
+#include <nlohmann/json.hpp>
+
+/**
+ * ServerConfig
+ *  - 서버 전역 설정값 모음
+ *  - 기본값으로 동작하며, JSON 설정 파일로 일부 값만 덮어쓸 수 있음
+ */
+struct ServerConfig {
+    // 게임 서버 포트
+    unsigned short port = 12345;
+
+    // 틱 모드 간격(ms)
+    // 0이면 비활성: 이동 즉시 맵 전체에 브로드캐스트
+    // 0보다 크면: 이동은 즉시 반영하고, 틱마다 맵 단위 스냅샷(변경분)만 전송
+    int tick_interval_ms = 0;
+
+    // 플레이어별 처리 대기 이동 입력 최대 수 (초과 입력은 버리고 위치 보정으로 복구)
+    int max_pending_moves = 32;
+
+    // 관심 영역 시야 반경 (체비셰프 거리, 칸 단위)
+    // 0이면 비활성: 이동을 맵 전체에 전송
+    // 0보다 크면: 이동 전/후 위치를 시야에 둔 플레이어에게만 전송 + 시야 진입/이탈 통지
+    int view_radius = 0;
+
+    // 지형 스트리밍 청크 크기 (칸 단위)
+    // 0이면 비활성: ROOM_CREATE 에 모든 맵의 장애물을 한 번에 전송
+    // 0보다 크면: 플레이어 주변(3x3 청크)의 장애물만 TERRAIN_CHUNK 로 점진 전송 (청크당 1회)
+    int terrain_chunk_size = 0;
+
+    // 맵 생성 시드: 0이면 방마다 무작위, 0이 아니면 모든 방이 같은 맵 (재현/테스트용)
+    uint32_t map_seed = 0;
+
+    // 매치메이킹
+    // - matchmaking_interval_ms: 편성 주기 (0이면 JOIN 마다 즉시 편성)
+    // - room_size: 방 최대 인원, min_room_fill: 방 편성 최소 인원
+    // - matchmaking_max_wait_ms: 최소 인원만으로 방을 만들기 전 대기 시간
+    // - matchmaking_rtt_bucket_ms: RTT 버킷 폭 (0이면 RTT 구분 없음)
+    int matchmaking_interval_ms = 100;
+    int room_size = 5;
+    int min_room_fill = 2;
+    int matchmaking_max_wait_ms = 0;
+    int matchmaking_rtt_bucket_ms = 0;
+
+    // 고정 스텝 시뮬레이션 간격(ms)
+    // 0이면 비활성: 이동 입력마다 즉시 처리
+    // 0보다 크면: 방마다 스텝 단위로 입력을 모아 처리하고, 결과는 스텝당 맵별 스냅샷 1회로 전송
+    //            (틱 모드 설정은 무시)
+    int simulation_step_ms = 0;
+
+    // 방 수명 관리
+    // - max_game_duration_ms: 방 생성 후 최대 게임 시간 (0이면 제한 없음, 초과 시 GAME_END)
+    // - room_reap_interval_ms: 방 점검 주기 (0이면 비활성) / room_reap_batch: 점검 1회당 최대 방 수
+    // (모든 플레이어가 나간 방은 점검을 기다리지 않고 마지막 플레이어가 나갈 때 바로 제거)
+    int max_game_duration_ms = 0;
+    int room_reap_interval_ms = 1000;
+    int room_reap_batch = 64;
+
+    // 방별 자원 예산 (최근 room_budget_window_ms 구간 합계, 0이면 제한 없음)
+    // - room_cpu_budget_ms: 방 핸들러 CPU 시간 / room_input_budget: 수신 이동 입력 수
+    // - room_output_budget_bytes: 방에서 보낸 바이트
+    // 하나라도 넘으면 구간 사용량이 내려갈 때까지 그 방의 이동 입력을 버림
+    int room_budget_window_ms = 10000;
+    int room_cpu_budget_ms = 0;
+    int room_input_budget = 0;
+    int room_output_budget_bytes = 0;
+
+    // 하트비트 / 유휴 커넥션 감지
+    // - heartbeat_interval_ms: PING 전송 주기 (0이면 비활성), PONG 으로 커넥션별 RTT 측정
+    // - idle_timeout_ms: 마지막 수신 후 이 시간이 지나면 연결 종료 (0이면 비활성)
+    int heartbeat_interval_ms = 0;
+    int idle_timeout_ms = 0;
+
+    // 로그
+    // - log_level: 최소 출력 레벨 ("trace" / "debug" / "info" / "warn" / "error" / "off")
+    // - log_file: 출력 파일 경로 ("" 이면 stdout)
+    std::string log_level = "info";
+    std::string log_file;
+
+    // 지표(metrics) 스냅샷 파일
+    // - metrics_file: Prometheus 텍스트 형식으로 주기 기록할 경로 ("" 이면 비활성)
+    // - metrics_dump_interval_ms: 기록 주기
+    std::string metrics_file;
+    int metrics_dump_interval_ms = 10000;
+
+    // 운영/진단용 HTTP 포트 (127.0.0.1 전용, 0이면 비활성)
+    unsigned short admin_port = 0;
+
+    // 요청 추적 (Chrome trace)
+    // - trace_enabled: 시작 시 추적 켜기 (admin /trace/start, /trace/stop 으로도 전환)
+    // - trace_buffer_spans: 스레드별 구간 버퍼 크기 (가득 차면 오래된 구간부터 덮어씀)
+    bool trace_enabled = false;
+    int trace_buffer_spans = 16384;
+
+    // CPU 샘플링 프로파일 (SIGUSR2 또는 admin /profile/start 로 시작)
+    // - cpu_profile_file: 기록 경로 (gperftools pprof 형식, 매번 덮어씀)
+    // - cpu_profile_seconds: 샘플링 시간 / cpu_profile_hz: 초당 샘플 수 (CPU 시간 기준)
+    std::string cpu_profile_file = "cpu.prof";
+    int cpu_profile_seconds = 10;
+    int cpu_profile_hz = 100;
+
+    // 뮤텍스 경합 프로파일링 (ProfiledMutex 획득/경합/대기/보유 시간 → 지표, admin /locks)
+    bool mutex_profiling = false;
+
+    // 타이머 휠 해상도(ms): 카운트다운/틱/매치메이킹 등 모든 타이머의 최소 단위
+    int timer_resolution_ms = 10;
+
+    // JSON 파일에서 설정 읽기 (없는 키는 기본값 유지)
+    static ServerConfig load_from_file(const std::string& path);
+
+    // JSON 으로 변환
+    nlohmann::json to_json() const;
+};
+
+#endif // SERVER_CONFIG_HPP
@@ -0,0 +1,140 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+/**
+ * SlotHandle
+ *  - 슬롯 인덱스 + 세대(generation) 로 구성된 정수 핸들
+ *  - 슬롯이 재사용되면 세대가 증가 → 예전 핸들은 자동으로 무효
+ *  - value(): 64비트 정수 (상위 32비트 세대, 하위 32비트 인덱스), 0은 항상 무효
+ */
+struct SlotHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0; // 0: 무효 핸들
+
+    uint64_t value() const {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+
+    static SlotHandle from_value(uint64_t v) {
+        return SlotHandle{static_cast<uint32_t>(v & 0xFFFFFFFFu), static_cast<uint32_t>(v >> 32)};
+    }
+
+    bool is_valid() const { return generation != 0; }
+
+    bool operator==(const SlotHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+namespace std {
+template <>
+struct hash<SlotHandle> {
+    size_t operator()(const SlotHandle& h) const noexcept {
+        return std::hash<uint64_t>()(h.value());
+    }
+};
+} // namespace std
+
+/**
+ * SlotMap<T>
+ *  - 세대 핸들로 접근하는 연속 저장소
+ *  - insert / erase / get 모두 O(1), 해제된 슬롯은 free list 로 재사용
+ *  - 내부 동기화 없음 (소유자가 잠금 관리)
+ */
+template <typename T>
+class SlotMap {
+public:
+    SlotHandle insert(T value) {
+        uint32_t index;
+        if (!free_list_.empty()) {
+            index = free_list_.back();
+            free_list_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+
+        Slot& slot = slots_[index];
+        slot.value = std::move(value);
+        slot.occupied = true;
+        ++size_;
+        return SlotHandle{index, slot.generation};
+    }
+
+    // 핸들이 가리키는 값 (무효 핸들이면 nullptr)
+    T* get(SlotHandle handle) {
+        if (!contains(handle)) return nullptr;
+        return &slots_[handle.index].value;
+    }
+
+    const T* get(SlotHandle handle) const {
+        if (!contains(handle)) return nullptr;
+        return &slots_[handle.index].value;
+    }
+
+    bool contains(SlotHandle handle) const {
+        return handle.is_valid()
+            && handle.index < slots_.size()
+            && slots_[handle.index].occupied
+            && slots_[handle.index].generation == handle.generation;
+    }
+
+    // 제거 후 세대 증가 (이후 같은 핸들로는 접근 불가)
+    bool erase(SlotHandle handle) {
+        if (!contains(handle)) return false;
+
+        Slot& slot = slots_[handle.index];
+        slot.value = T();
+        slot.occupied = false;
+        if (++slot.generation == 0) slot.generation = 1; // 0은 무효 핸들 전용
+        free_list_.push_back(handle.index);
+        --size_;
+        return true;
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // 슬롯 수 (빈 슬롯 포함) / index 슬롯의 현재 핸들 (비어 있으면 무효 핸들)
+    // → 커서 기반 점진 순회용
+    std::size_t capacity() const { return slots_.size(); }
+    SlotHandle handle_at(uint32_t index) const {
+        if (index >= slots_.size() || !slots_[index].occupied) return SlotHandle{};
+        return SlotHandle{index, slots_[index].generation};
+    }
+
+    // 살아있는 모든 값 순회: fn(SlotHandle, T&)
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (uint32_t i = 0; i < slots_.size(); ++i) {
+            if (slots_[i].occupied) fn(SlotHandle{i, slots_[i].generation}, slots_[i].value);
+        }
+    }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (uint32_t i = 0; i < slots_.size(); ++i) {
+            if (slots_[i].occupied) fn(SlotHandle{i, slots_[i].generation}, slots_[i].value);
+        }
+    }
+
+private:
+    struct Slot {
+        T value{};
+        uint32_t generation = 1;
+        bool occupied = false;
+    };
+
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_list_;
+    std::size_t size_ = 0;
+};
+
+#endif // SLOT_MAP_HPP
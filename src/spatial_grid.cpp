@@ -0,0 +1,94 @@
+#include "spatial_grid.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+SpatialGrid::SpatialGrid(int width, int height, int cell_size)
+    : cell_size_(std::max(1, cell_size))
+    , cols_((std::max(1, width) + cell_size_ - 1) / cell_size_)
+    , rows_((std::max(1, height) + cell_size_ - 1) / cell_size_)
+    , cells_(static_cast<std::size_t>(cols_ * rows_))
+{
+}
+
+/**
+ * 좌표 → 셀 인덱스 (맵 밖 좌표는 가장자리 셀로 보정)
+ */
+int SpatialGrid::cell_index(const Point& pos) const
+{
+    int cx = std::clamp(pos.x / cell_size_, 0, cols_ - 1);
+    int cy = std::clamp(pos.y / cell_size_, 0, rows_ - 1);
+    return cy * cols_ + cx;
+}
+
+int SpatialGrid::distance(const Point& a, const Point& b)
+{
+    return std::max(std::abs(a.x - b.x), std::abs(a.y - b.y));
+}
+
+void SpatialGrid::insert(const std::shared_ptr<Player>& p, const Point& pos)
+{
+    if (positions_.count(p.get())) {
+        move(p, pos);
+        return;
+    }
+    positions_[p.get()] = pos;
+    cells_[cell_index(pos)].push_back(p);
+}
+
+void SpatialGrid::remove(const std::shared_ptr<Player>& p)
+{
+    auto it = positions_.find(p.get());
+    if (it == positions_.end()) {
+        return;
+    }
+    auto& cell = cells_[cell_index(it->second)];
+    cell.erase(std::remove(cell.begin(), cell.end(), p), cell.end());
+    positions_.erase(it);
+}
+
+void SpatialGrid::move(const std::shared_ptr<Player>& p, const Point& new_pos)
+{
+    auto it = positions_.find(p.get());
+    if (it == positions_.end()) {
+        insert(p, new_pos);
+        return;
+    }
+
+    int old_cell = cell_index(it->second);
+    int new_cell = cell_index(new_pos);
+    it->second = new_pos;
+    if (old_cell == new_cell) {
+        return;
+    }
+
+    auto& cell = cells_[old_cell];
+    cell.erase(std::remove(cell.begin(), cell.end(), p), cell.end());
+    cells_[new_cell].push_back(p);
+}
+
+Point SpatialGrid::position_of(const std::shared_ptr<Player>& p) const
+{
+    auto it = positions_.find(p.get());
+    return it != positions_.end() ? it->second : Point{-1, -1};
+}
+
+std::vector<std::shared_ptr<Player>> SpatialGrid::query(const Point& center, int radius) const
+{
+    std::vector<std::shared_ptr<Player>> result;
+
+    int min_cx = std::clamp((center.x - radius) / cell_size_, 0, cols_ - 1);
+    int max_cx = std::clamp((center.x + radius) / cell_size_, 0, cols_ - 1);
+    int min_cy = std::clamp((center.y - radius) / cell_size_, 0, rows_ - 1);
+    int max_cy = std::clamp((center.y + radius) / cell_size_, 0, rows_ - 1);
+
+    for (int cy = min_cy; cy <= max_cy; ++cy) {
+        for (int cx = min_cx; cx <= max_cx; ++cx) {
+            for (const auto& p : cells_[cy * cols_ + cx]) {
+                if (distance(positions_.at(p.get()), center) <= radius) {
+                    result.push_back(p);
+                }
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,43 @@
+#ifndef SPATIAL_GRID_HPP
+#define SPATIAL_GRID_HPP
+
+#include "point.hpp"
+#include "player.hpp"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * SpatialGrid
+ *  - 맵 내 플레이어 위치를 균일한 격자 버킷으로 색인 (관심 영역 계산용)
+ *  - 셀 크기를 시야 반경과 같게 두면, 시야 조회 시 주변 3x3 셀만 확인
+ *  - 시야 판정은 체비셰프 거리 (클라이언트의 8방향 시야와 동일한 사각형 영역)
+ *  - 내부 동기화 없음 (Map 의 map_mutex_ 로 보호)
+ */
+class SpatialGrid {
+public:
+    SpatialGrid(int width, int height, int cell_size);
+
+    void insert(const std::shared_ptr<Player>& p, const Point& pos);
+    void remove(const std::shared_ptr<Player>& p);
+    void move(const std::shared_ptr<Player>& p, const Point& new_pos);
+
+    // center 에서 radius(체비셰프 거리) 이내의 플레이어 목록
+    std::vector<std::shared_ptr<Player>> query(const Point& center, int radius) const;
+
+    // 색인된 위치 (색인되지 않았으면 {-1, -1})
+    Point position_of(const std::shared_ptr<Player>& p) const;
+
+    static int distance(const Point& a, const Point& b);
+
+private:
+    int cell_index(const Point& pos) const;
+
+    int cell_size_;
+    int cols_;
+    int rows_;
+    std::vector<std::vector<std::shared_ptr<Player>>> cells_;
+    std::unordered_map<Player*, Point> positions_; // 색인된 위치
+};
+
+#endif // SPATIAL_GRID_HPP
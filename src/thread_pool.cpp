@@ -1,5 +1,25 @@
 #include "thread_pool.hpp"
-#include <iostream>
+#include "logger.hpp"
+#include "metrics.hpp"
+#include "cpu_profiler.hpp"
+
+namespace {
+
+struct PoolMetrics {
+    Gauge& queue_depth;
+    Histogram& queue_wait_us;
+};
+
+PoolMetrics& pool_metrics()
+{
+    static PoolMetrics m {
+        MetricsRegistry::get_instance().gauge("asio_server_thread_pool_queue_depth", "Tasks waiting for a worker"),
+        MetricsRegistry::get_instance().histogram("asio_server_thread_pool_queue_wait_us", "Time a task waits in the pool queue"),
+    };
+    return m;
+}
+
+} // namespace
 
 // 생성자: 초기 스레드 수만큼 워커 생성
 ThreadPool::ThreadPool(std::size_t num_threads) : stop_(false) {
@@ -11,7 +31,7 @@ ThreadPool::ThreadPool(std::size_t num_threads) : stop_(false) {
 // 소멸자: 모든 스레드 종료
 ThreadPool::~ThreadPool() {
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        std::lock_guard<ProfiledMutex> lock(mutex_);
         stop_ = true;
     }
     cond_var_.notify_all(); // 모든 대기 중인 스레드를 깨움
@@ -26,8 +46,9 @@ ThreadPool::~ThreadPool() {
 // 작업 추가
 void ThreadPool::enqueue_task(const std::function<void()>& task) {
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        tasks_.push(task);
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        tasks_.push(Task{task, std::chrono::steady_clock::now()});
+        pool_metrics().queue_depth.set(static_cast<int64_t>(tasks_.size()));
     }
     cond_var_.notify_one();
 }
@@ -39,16 +60,23 @@ void ThreadPool::add_worker() {
 
 // 현재 워커 스레드 수 반환
 std::size_t ThreadPool::worker_count() const {
-    std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(mutex_)); // TODO: 타입 캐스팅 없이 작동하도록 수정해야 함.
+    std::lock_guard<ProfiledMutex> lock(mutex_);
     return workers_.size();
 }
 
+// 대기 중인 작업 수 반환
+std::size_t ThreadPool::queued_task_count() const {
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return tasks_.size();
+}
+
 // 워커 스레드의 작업 처리
 void ThreadPool::worker_thread() {
+    CpuProfiler::register_thread();
     while (true) {
-        std::function<void()> task;
+        Task task;
         {
-            std::unique_lock<std::mutex> lock(mutex_);
+            std::unique_lock<ProfiledMutex> lock(mutex_);
             cond_var_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
 
             if (stop_ && tasks_.empty()) {
@@ -57,15 +85,19 @@ void ThreadPool::worker_thread() {
 
             task = std::move(tasks_.front());
             tasks_.pop();
+            pool_metrics().queue_depth.set(static_cast<int64_t>(tasks_.size()));
         }
+        auto waited = std::chrono::steady_clock::now() - task.enqueued_at;
+        pool_metrics().queue_wait_us.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(waited).count()));
 
         // 작업 실행
         try {
-            task();
+            task.fn();
         } catch (const std::exception& e) {
-            std::cerr << "Error while executing task: " << e.what() << std::endl;
+            LOG_ERROR("[ThreadPool] Error while executing task: " << e.what());
         } catch (...) {
-            std::cerr << "Unknown error while executing task." << std::endl;
+            LOG_ERROR("[ThreadPool] Unknown error while executing task.");
         }
     }
 }
@@ -7,6 +7,8 @@
 #include <condition_variable>
 #include <functional>
 #include <vector>
+#include <chrono>
+#include "profiled_mutex.hpp"
 
 class ThreadPool {
 public:
@@ -16,15 +18,20 @@ public:
     void enqueue_task(const std::function<void()>& task); // 작업 추가
     void add_worker();                                   // 워커 스레드 추가
     std::size_t worker_count() const;                   // 현재 워커 스레드 수 반환
+    std::size_t queued_task_count() const;              // 대기 중인 작업 수 반환
 
 private:
     void worker_thread();                                // 워커 스레드 작업 처리 함수
 
     std::vector<std::thread> workers_;
-    std::queue<std::function<void()>> tasks_;           // 작업 큐
+    struct Task {
+        std::function<void()> fn;
+        std::chrono::steady_clock::time_point enqueued_at; // 큐 대기 시간 측정용
+    };
+    std::queue<Task> tasks_;                            // 작업 큐
 
-    std::mutex mutex_;
-    std::condition_variable cond_var_;
+    mutable ProfiledMutex mutex_{"thread_pool"};
+    std::condition_variable_any cond_var_;             // ProfiledMutex 와 함께 사용
     bool stop_;                                         // 스레드풀 중지 플래그
 };
 
@@ -0,0 +1,146 @@
+#include "timer_service.hpp"
+#include "logger.hpp"
+
+std::unique_ptr<TimerService> TimerService::instance_ = nullptr;
+
+namespace {
+
+// run_due 실행 중인 스레드의 만료 이벤트 묶음 (이벤트 타이머 콜백이 여기에 추가)
+thread_local std::vector<Event>* t_due_events = nullptr;
+
+} // namespace
+
+TimerService::TimerService(boost::asio::io_context& ioc, int resolution_ms)
+    : timer_(ioc)
+    , resolution_(std::max(resolution_ms, 1))
+    , epoch_(std::chrono::steady_clock::now())
+{
+    LOG_INFO("[TimerService] resolution=" << resolution_.count() << "ms");
+}
+
+uint64_t TimerService::now_tick() const
+{
+    return static_cast<uint64_t>((std::chrono::steady_clock::now() - epoch_) / resolution_);
+}
+
+/**
+ * 타이머 등록
+ * - 틱 단위로 올림 (요청 시간보다 일찍 만료되지 않도록)
+ * - steady_timer 가 멈춰 있으면 io 스레드에서 다시 시작
+ */
+TimerService::TimerId TimerService::schedule_after(std::chrono::milliseconds delay, Callback callback)
+{
+    uint64_t ticks = static_cast<uint64_t>((delay + resolution_ - std::chrono::milliseconds(1)) / resolution_);
+
+    TimerId id;
+    bool start = false;
+    {
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        if (!armed_) {
+            // 쉬고 있던 동안(휠이 비어 있음)의 틱을 건너뜀
+            std::vector<Callback> due;
+            wheel_.advance_to(now_tick(), due);
+            if (!due.empty()) {
+                boost::asio::post(timer_.get_executor(), [this, due = std::move(due)]() mutable { run_due(due); });
+            }
+            armed_ = true;
+            start = true;
+        }
+        id = wheel_.schedule(ticks, std::move(callback));
+    }
+
+    if (start) {
+        boost::asio::post(timer_.get_executor(), [this]() { arm(); });
+    }
+    return id;
+}
+
+/**
+ * 이벤트 타이머 등록
+ * - 만료 시 바로 enqueue 하지 않고 같은 틱의 묶음에 추가 (created_at 은 만료 시점으로 갱신)
+ * - 묶음 밖에서 실행되면(예외적인 경우) 이벤트 하나짜리 묶음으로 전달
+ */
+TimerService::TimerId TimerService::schedule_event_after(std::chrono::milliseconds delay, Event event)
+{
+    return schedule_after(delay, [this, event = std::move(event)]() mutable {
+        event.created_at = std::chrono::steady_clock::now();
+        if (t_due_events) {
+            t_due_events->push_back(std::move(event));
+        } else if (event_batch_handler_) {
+            event_batch_handler_(std::vector<Event>{std::move(event)});
+        }
+    });
+}
+
+bool TimerService::cancel(TimerId id)
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return wheel_.cancel(id);
+}
+
+std::size_t TimerService::pending_count() const
+{
+    std::lock_guard<ProfiledMutex> lock(mutex_);
+    return wheel_.size();
+}
+
+void TimerService::arm()
+{
+    timer_.expires_after(resolution_);
+    timer_.async_wait([this](const boost::system::error_code& ec) { on_tick(ec); });
+}
+
+/**
+ * 틱 처리: 지나간 틱의 만료 타이머를 모아 한 번에 실행
+ * - 남은 타이머가 없으면 멈춤 (다음 schedule_after 에서 재시작)
+ */
+void TimerService::on_tick(const boost::system::error_code& ec)
+{
+    if (ec) {
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        armed_ = false;
+        return;
+    }
+
+    std::vector<Callback> due;
+    bool rearm;
+    {
+        std::lock_guard<ProfiledMutex> lock(mutex_);
+        wheel_.advance_to(now_tick(), due);
+        rearm = !wheel_.empty();
+        armed_ = rearm;
+    }
+
+    run_due(due);
+
+    if (rearm) {
+        arm();
+    }
+}
+
+/**
+ * 만료 콜백 실행
+ * - 이벤트 타이머는 콜백 실행 중 묶음에 모였다가, 마지막에 batch handler 로 한 번만 전달
+ */
+void TimerService::run_due(std::vector<Callback>& due)
+{
+    std::vector<Event> events;
+    t_due_events = &events;
+    for (auto& cb : due) {
+        try {
+            cb();
+        } catch (const std::exception& e) {
+            LOG_ERROR("[TimerService] callback error: " << e.what());
+        }
+    }
+    t_due_events = nullptr;
+
+    if (events.empty()) {
+        return;
+    }
+    if (!event_batch_handler_) {
+        LOG_WARN("[TimerService] no event batch handler, dropping " << events.size() << " events");
+        return;
+    }
+    event_batch_handler_(std::move(events));
+}
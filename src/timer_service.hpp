@@ -0,0 +1,81 @@
+#ifndef TIMER_SERVICE_HPP
+#define TIMER_SERVICE_HPP
+
+#include "timing_wheel.hpp"
+#include "event.hpp"
+#include "profiled_mutex.hpp"
+#include <boost/asio.hpp>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * TimerService
+ *  - 서버 전체 타이머 (카운트다운, 틱, 매치메이킹, 타임아웃 등)
+ *  - 타이밍 휠 1개 + steady_timer 1개로 동작 (타이머마다 힙 타이머를 만들지 않음)
+ *  - 대기 중인 타이머가 있을 때만 resolution 간격으로 깨어나고,
+ *    만료된 콜백은 io 스레드에서 한 번에 실행 (콜백은 보통 이벤트 enqueue 만 수행)
+ *  - 방 타이머(카운트다운, 틱, 시뮬레이션 스텝)는 이벤트로 등록 → 같은 틱에 만료된 이벤트를 모아
+ *    batch handler 로 한 번에 넘김 (방마다 리액터 큐를 거치지 않음)
+ */
+class TimerService {
+public:
+    using Callback = TimingWheel::Callback;
+    using TimerId = TimingWheel::TimerId;
+    using EventBatchHandler = std::function<void(std::vector<Event>)>;
+
+    static TimerService& get_instance() {
+        if (!instance_) {
+            throw std::runtime_error("TimerService instance is not initialized. Call initialize_instance() first.");
+        }
+        return *instance_;
+    }
+
+    static void initialize_instance(boost::asio::io_context& ioc, int resolution_ms) {
+        if (!instance_) {
+            instance_ = std::unique_ptr<TimerService>(new TimerService(ioc, resolution_ms));
+        }
+    }
+
+    // delay 후 콜백 실행 (어느 스레드에서든 호출 가능)
+    TimerId schedule_after(std::chrono::milliseconds delay, Callback callback);
+
+    // delay 후 GAME event 를 만료 묶음에 추가 (묶음은 batch handler 로 한 번에 전달)
+    TimerId schedule_event_after(std::chrono::milliseconds delay, Event event);
+
+    // 만료 이벤트 묶음 처리기 (서버 시작 전, 리액터가 한 번 설정)
+    void set_event_batch_handler(EventBatchHandler handler) { event_batch_handler_ = std::move(handler); }
+
+    // 만료 전 취소 (O(1))
+    bool cancel(TimerId id);
+
+    std::size_t pending_count() const;
+
+private:
+    TimerService(boost::asio::io_context& ioc, int resolution_ms);
+
+    static std::unique_ptr<TimerService> instance_;
+
+    TimerService(const TimerService&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+
+    uint64_t now_tick() const;
+    void arm();
+    void on_tick(const boost::system::error_code& ec);
+    void run_due(std::vector<Callback>& due);
+
+    boost::asio::steady_timer timer_;
+    const std::chrono::milliseconds resolution_;
+    const std::chrono::steady_clock::time_point epoch_;
+
+    mutable ProfiledMutex mutex_{"timer_service"}; // wheel_, armed_ 보호
+    TimingWheel wheel_;
+    bool armed_ = false;       // steady_timer 대기 중 여부
+
+    EventBatchHandler event_batch_handler_;
+};
+
+#endif // TIMER_SERVICE_HPP
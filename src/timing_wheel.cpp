@@ -0,0 +1,98 @@
+#include "timing_wheel.hpp"
+#include <algorithm>
+
+TimingWheel::TimingWheel(uint64_t start_tick)
+    : current_tick_(start_tick)
+{
+}
+
+TimingWheel::TimerId TimingWheel::schedule(uint64_t delay_ticks, Callback callback)
+{
+    uint64_t expiry = current_tick_ + std::max<uint64_t>(delay_ticks, 1);
+    TimerId id = timers_.insert(Timer{expiry, std::move(callback)});
+    place(id, expiry);
+    return id;
+}
+
+bool TimingWheel::cancel(TimerId id)
+{
+    return timers_.erase(id);
+}
+
+/**
+ * 남은 틱 수에 맞는 단계의 칸에 배치
+ * - 최상위 단계 범위를 넘으면 최상위 단계 마지막 칸에 두고, 내려올 때 다시 배치
+ */
+void TimingWheel::place(TimerId id, uint64_t expiry)
+{
+    uint64_t delta = expiry > current_tick_ ? expiry - current_tick_ : 0;
+    for (int level = 0; level < kLevels; ++level) {
+        uint64_t range = uint64_t(1) << (kSlotBits * (level + 1));
+        if (delta < range || level == kLevels - 1) {
+            uint64_t target = std::min(expiry, current_tick_ + range - 1);
+            std::size_t slot = (target >> (kSlotBits * level)) & (kSlots - 1);
+            wheel_[level][slot].push_back(id);
+            return;
+        }
+    }
+}
+
+/**
+ * 상위 단계 칸의 타이머를 현재 틱 기준으로 다시 배치
+ */
+void TimingWheel::cascade(int level, std::size_t slot)
+{
+    std::vector<TimerId> ids;
+    ids.swap(wheel_[level][slot]);
+    for (auto id : ids) {
+        if (auto* timer = timers_.get(id)) {
+            place(id, timer->expiry);
+        }
+    }
+}
+
+void TimingWheel::advance_to(uint64_t tick, std::vector<Callback>& due)
+{
+    // 비어 있으면 바로 이동
+    if (timers_.empty()) {
+        current_tick_ = std::max(current_tick_, tick);
+        return;
+    }
+
+    while (current_tick_ < tick) {
+        ++current_tick_;
+
+        // 0단계가 한 바퀴 돌 때마다 상위 단계 칸을 내려보냄
+        for (int level = 1; level < kLevels; ++level) {
+            uint64_t lower_mask = (uint64_t(1) << (kSlotBits * level)) - 1;
+            if ((current_tick_ & lower_mask) != 0) {
+                break;
+            }
+            cascade(level, (current_tick_ >> (kSlotBits * level)) & (kSlots - 1));
+        }
+
+        auto& bucket = wheel_[0][current_tick_ & (kSlots - 1)];
+        if (bucket.empty()) {
+            continue;
+        }
+        std::vector<TimerId> ids;
+        ids.swap(bucket);
+        for (auto id : ids) {
+            auto* timer = timers_.get(id);
+            if (!timer) {
+                continue; // 취소됨
+            }
+            if (timer->expiry > current_tick_) {
+                place(id, timer->expiry); // 범위를 넘겨 잘려 있던 타이머
+                continue;
+            }
+            due.push_back(std::move(timer->callback));
+            timers_.erase(id);
+        }
+
+        if (timers_.empty()) {
+            current_tick_ = std::max(current_tick_, tick);
+            return;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef TIMING_WHEEL_HPP
+#define TIMING_WHEEL_HPP
+
+#include "slot_map.hpp"
+#include <array>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * TimingWheel
+ *  - 계층형 타이밍 휠 (4단계 x 64칸, 틱 단위)
+ *    0단계: 64틱, 1단계: 64^2틱, 2단계: 64^3틱, 3단계: 64^4틱 범위
+ *  - 등록 O(1), 취소 O(1) (슬롯 맵에서만 제거, 휠 칸의 핸들은 만료 시 건너뜀)
+ *  - advance_to(): 지나간 틱의 만료 타이머를 한 번에 모아서 반환 (실행은 호출자)
+ *  - 내부 동기화 없음 (TimerService 가 잠금 관리)
+ */
+class TimingWheel {
+public:
+    using Callback = std::function<void()>;
+    using TimerId = SlotHandle;
+
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr int kSlots = 1 << kSlotBits;
+
+    explicit TimingWheel(uint64_t start_tick = 0);
+
+    // delay_ticks 후 만료 (0이면 다음 틱)
+    TimerId schedule(uint64_t delay_ticks, Callback callback);
+
+    // 만료 전 취소 (이미 만료/취소된 타이머면 false)
+    bool cancel(TimerId id);
+
+    // tick 까지 진행하며 만료된 콜백을 due 에 추가 (만료 순서대로)
+    void advance_to(uint64_t tick, std::vector<Callback>& due);
+
+    uint64_t current_tick() const { return current_tick_; }
+    std::size_t size() const { return timers_.size(); }
+    bool empty() const { return timers_.empty(); }
+
+private:
+    struct Timer {
+        uint64_t expiry = 0;
+        Callback callback;
+    };
+
+    void place(TimerId id, uint64_t expiry);
+    void cascade(int level, std::size_t slot);
+
+    uint64_t current_tick_;
+    SlotMap<Timer> timers_;
+    std::array<std::array<std::vector<TimerId>, kSlots>, kLevels> wheel_;
+};
+
+#endif // TIMING_WHEEL_HPP
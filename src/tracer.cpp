@@ -0,0 +1,177 @@
+#include "tracer.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+namespace {
+
+thread_local uint64_t tls_trace_id = 0;
+
+void copy_name(char* dst, const char* src)
+{
+    std::strncpy(dst, src, Tracer::kNameSize - 1);
+    dst[Tracer::kNameSize - 1] = '\0';
+}
+
+} // namespace
+
+Tracer::Tracer()
+    : epoch_(std::chrono::steady_clock::now())
+{
+}
+
+uint64_t Tracer::current_trace_id()
+{
+    return tls_trace_id;
+}
+
+void Tracer::set_current_trace_id(uint64_t id)
+{
+    tls_trace_id = id;
+}
+
+int64_t Tracer::now_us() const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - epoch_).count();
+}
+
+/**
+ * 호출 스레드 전용 버퍼 (처음 기록할 때 생성해 등록)
+ * - 스레드가 종료돼도 buffers_ 가 소유 → dump 에 그대로 포함
+ */
+Tracer::ThreadBuffer& Tracer::local_buffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        buffer->spans.resize(capacity_.load());
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffer->tid = static_cast<uint32_t>(buffers_.size());
+        buffers_.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Tracer::record(const char* name, uint64_t trace_id, int64_t ts_us, int64_t dur_us)
+{
+    ThreadBuffer& buf = local_buffer();
+    std::lock_guard<std::mutex> lock(buf.mutex);
+    Span& span = buf.spans[buf.next];
+    copy_name(span.name, name);
+    span.trace_id = trace_id;
+    span.ts_us = ts_us;
+    span.dur_us = dur_us;
+    span.tid = buf.tid;
+    if (++buf.next == buf.spans.size()) {
+        buf.next = 0;
+        buf.wrapped = true;
+    }
+}
+
+std::size_t Tracer::span_count() const
+{
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    std::size_t total = 0;
+    for (const auto& buf : buffers_) {
+        std::lock_guard<std::mutex> buf_lock(buf->mutex);
+        total += buf->wrapped ? buf->spans.size() : buf->next;
+    }
+    return total;
+}
+
+void Tracer::clear()
+{
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    for (const auto& buf : buffers_) {
+        std::lock_guard<std::mutex> buf_lock(buf->mutex);
+        buf->next = 0;
+        buf->wrapped = false;
+    }
+}
+
+/**
+ * Chrome trace JSON
+ * - 구간: {"ph":"X","ts","dur"} / 순간 이벤트: {"ph":"i","s":"t"}
+ * - tid: 기록한 스레드, args.trace_id: 같은 요청의 구간을 묶어 보는 용도
+ */
+std::string Tracer::dump_chrome_json(bool clear)
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffers = buffers_;
+    }
+
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    char line[256];
+
+    for (const auto& buf : buffers) {
+        std::lock_guard<std::mutex> lock(buf->mutex);
+        const std::size_t count = buf->wrapped ? buf->spans.size() : buf->next;
+        const std::size_t start = buf->wrapped ? buf->next : 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const Span& s = buf->spans[(start + i) % buf->spans.size()];
+            int n;
+            if (s.dur_us >= 0) {
+                n = std::snprintf(line, sizeof(line),
+                    "{\"name\":\"%s\",\"cat\":\"server\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%u,\"args\":{\"trace_id\":%llu}}",
+                    s.name, static_cast<long long>(s.ts_us), static_cast<long long>(s.dur_us), s.tid,
+                    static_cast<unsigned long long>(s.trace_id));
+            } else {
+                n = std::snprintf(line, sizeof(line),
+                    "{\"name\":\"%s\",\"cat\":\"server\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,\"tid\":%u,\"args\":{\"trace_id\":%llu}}",
+                    s.name, static_cast<long long>(s.ts_us), s.tid,
+                    static_cast<unsigned long long>(s.trace_id));
+            }
+            if (!first) out << ",";
+            out.write(line, std::min<int>(n, sizeof(line) - 1));
+            first = false;
+        }
+        if (clear) {
+            buf->next = 0;
+            buf->wrapped = false;
+        }
+    }
+    out << "]}";
+    return out.str();
+}
+
+TraceSpan::TraceSpan(const char* name, uint64_t trace_id)
+    : active_(Tracer::get_instance().enabled())
+    , trace_id_(0)
+    , prev_trace_id_(0)
+    , start_us_(0)
+{
+    if (!active_) {
+        return;
+    }
+    copy_name(name_, name);
+    prev_trace_id_ = Tracer::current_trace_id();
+    trace_id_ = trace_id ? trace_id : prev_trace_id_;
+    Tracer::set_current_trace_id(trace_id_);
+    start_us_ = Tracer::get_instance().now_us();
+}
+
+TraceSpan::TraceSpan(const char* name, int number, uint64_t trace_id)
+    : TraceSpan(name, trace_id)
+{
+    if (active_) {
+        char buf[Tracer::kNameSize];
+        std::snprintf(buf, sizeof(buf), "%s %d", name, number);
+        copy_name(name_, buf);
+    }
+}
+
+TraceSpan::~TraceSpan()
+{
+    if (!active_) {
+        return;
+    }
+    auto& tracer = Tracer::get_instance();
+    tracer.record(name_, trace_id_, start_us_, tracer.now_us() - start_us_);
+    Tracer::set_current_trace_id(prev_trace_id_);
+}
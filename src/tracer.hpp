@@ -0,0 +1,122 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Tracer
+ *  - 선택적 요청 추적: 수신 프레임마다 trace id 를 발급하고, 단계별 구간(span)을 기록
+ *    (프레임 수신 → enqueue → dispatch → 핸들러 → 브로드캐스트 → 쓰기 완료)
+ *  - 구간은 스레드별 고정 크기 버퍼에 기록 (가득 차면 가장 오래된 것부터 덮어씀)
+ *  - dump_chrome_json(): Chrome / Perfetto 에서 열 수 있는 trace JSON
+ *  - 꺼져 있으면 TRACE_SPAN / TRACE_INSTANT 비용은 atomic load 1회
+ */
+class Tracer {
+public:
+    static constexpr std::size_t kNameSize = 40;
+
+    struct Span {
+        char name[kNameSize];
+        uint64_t trace_id;
+        int64_t ts_us;   // 시작 시각 (Tracer 생성 기준)
+        int64_t dur_us;  // 길이 (-1: 순간 이벤트)
+        uint32_t tid;    // 버퍼 등록 순서
+    };
+
+    static Tracer& get_instance() {
+        static Tracer instance;
+        return instance;
+    }
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+    void set_enabled(bool on) { enabled_.store(on, std::memory_order_relaxed); }
+
+    // 스레드별 버퍼 크기 (이후 새로 만들어지는 버퍼부터 적용)
+    void set_buffer_capacity(std::size_t spans) { capacity_.store(spans == 0 ? 1 : spans); }
+
+    // 새 trace id (0은 "없음")
+    uint64_t next_trace_id() { return next_id_.fetch_add(1, std::memory_order_relaxed); }
+
+    // 현재 스레드가 처리 중인 trace id (핸들러 구간 동안 설정 → 브로드캐스트/쓰기 구간이 이어받음)
+    static uint64_t current_trace_id();
+    static void set_current_trace_id(uint64_t id);
+
+    int64_t now_us() const;
+    void record(const char* name, uint64_t trace_id, int64_t ts_us, int64_t dur_us);
+
+    // Chrome trace JSON ({"traceEvents": [...]}), clear=true 면 기록 비움
+    std::string dump_chrome_json(bool clear = false);
+
+    std::size_t span_count() const;
+    void clear();
+
+private:
+    Tracer();
+
+    struct ThreadBuffer {
+        std::mutex mutex;       // 소유 스레드 기록 vs dump (평소 경합 없음)
+        std::vector<Span> spans;
+        std::size_t next = 0;   // 다음 기록 위치
+        bool wrapped = false;   // 한 바퀴 돌았는지
+        uint32_t tid = 0;
+    };
+
+    ThreadBuffer& local_buffer();
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<std::size_t> capacity_{16384};
+    std::atomic<uint64_t> next_id_{1};
+    const std::chrono::steady_clock::time_point epoch_;
+
+    mutable std::mutex buffers_mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+};
+
+/**
+ * TraceSpan: 생성~소멸 구간 기록 (RAII)
+ *  - trace_id 가 0이 아니면 구간 동안 현재 스레드 trace id 로 설정
+ */
+class TraceSpan {
+public:
+    TraceSpan(const char* name, uint64_t trace_id);
+    // 이름 뒤에 번호 부착 (예: "game_handler 204"), 켜져 있을 때만 포맷팅
+    TraceSpan(const char* name, int number, uint64_t trace_id);
+    ~TraceSpan();
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    bool active_;
+    char name_[Tracer::kNameSize];
+    uint64_t trace_id_;
+    uint64_t prev_trace_id_;
+    int64_t start_us_;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+// 구간 기록: 현재 블록 끝까지 (trace_id 0이면 현재 스레드 trace id 사용)
+#define TRACE_SPAN(name, trace_id) \
+    TraceSpan TRACE_CONCAT(trace_span_, __LINE__)(name, trace_id)
+
+// 순간 이벤트 기록
+#define TRACE_INSTANT(name, trace_id)                                                   \
+    do {                                                                                \
+        if (Tracer::get_instance().enabled()) {                                         \
+            auto& tracer_ = Tracer::get_instance();                                     \
+            tracer_.record(name, trace_id, tracer_.now_us(), -1);                       \
+        }                                                                               \
+    } while (0)
+
+#endif // TRACER_HPP
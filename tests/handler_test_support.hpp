@@ -0,0 +1,237 @@
+#ifndef HANDLER_TEST_SUPPORT_HPP
+#define HANDLER_TEST_SUPPORT_HPP
+
+#include "reactor.hpp"
+#include "timer_service.hpp"
+#include "connection.hpp"
+#include "connection_manager.hpp"
+#include "game_manager.hpp"
+#include "game_event_handler.hpp"
+#include "room.hpp"
+#include <boost/asio.hpp>
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * 핸들러 테스트 공용 도구
+ *  - 핸들러를 직접 호출해 한 단계씩 진행하고, 클라이언트 쪽 소켓으로 실제 전송된 프레임을 확인
+ */
+namespace test_support {
+
+/**
+ * Reactor / TimerService 싱글톤 (프로세스당 한 번)
+ *  - io_context 는 돌리지 않음 → 핸들러가 예약한 타이머는 실행되지 않음
+ *  - 스레드풀 워커 0개 → Reactor 로 enqueue 된 후속 이벤트는 쌓이기만 하고 실행되지 않음
+ *  - 정적 소멸 순서 문제를 피하기 위해 해제하지 않음
+ */
+inline void init_runtime()
+{
+    static const bool initialized = [] {
+        auto* ioc = new boost::asio::io_context();
+        auto* pool = new ThreadPool(0);
+        auto* gm = new GameManager();
+        TimerService::initialize_instance(*ioc, 10);
+        Reactor::initialize_instance(*ioc, 0, *pool, *gm);
+        return true;
+    }();
+    (void)initialized;
+}
+
+struct Frame {
+    uint16_t main_type = 0;
+    uint16_t sub_type = 0;
+    nlohmann::json body;
+};
+
+/**
+ * TestClient: loopback TCP 소켓 쌍
+ *  - 서버 쪽 소켓으로 Connection 을 만들고 Player 와 함께 ConnectionManager 에 등록
+ *  - read_frames(): 서버 송신 큐를 비운 뒤 클라이언트 쪽에 도착한 프레임을 모두 읽음
+ */
+class TestClient {
+public:
+    TestClient(boost::asio::io_context& io, const std::string& name)
+        : io_(io)
+        , socket_(io)
+    {
+        tcp::acceptor acceptor(io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        socket_.connect(acceptor.local_endpoint());
+        tcp::socket server(io);
+        acceptor.accept(server);
+
+        conn = std::make_shared<Connection>(std::move(server));
+        player = std::make_shared<Player>(name);
+        ConnectionManager::get_instance().add_connection(conn);
+        ConnectionManager::get_instance().register_connection(player, conn);
+    }
+
+    ~TestClient() {
+        ConnectionManager::get_instance().unregister_connection(player);
+        ConnectionManager::get_instance().remove_connection(conn);
+    }
+
+    TestClient(const TestClient&) = delete;
+    TestClient& operator=(const TestClient&) = delete;
+
+    std::vector<Frame> read_frames() {
+        for (int i = 0; i < 200; ++i) {
+            io_.restart();
+            io_.poll();
+            if (conn->pending_write_count() == 0) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        boost::system::error_code ec;
+        while (socket_.available(ec) > 0 && !ec) {
+            std::vector<char> chunk(socket_.available(ec));
+            std::size_t n = socket_.read_some(boost::asio::buffer(chunk), ec);
+            buffer_.insert(buffer_.end(), chunk.begin(), chunk.begin() + n);
+        }
+
+        std::vector<Frame> frames;
+        while (buffer_.size() >= 8) {
+            uint32_t length = 0;
+            Frame f;
+            std::memcpy(&f.main_type, &buffer_[0], 2);
+            std::memcpy(&f.sub_type, &buffer_[2], 2);
+            std::memcpy(&length, &buffer_[4], 4);
+            std::size_t padded = (length + 7) / 8 * 8;
+            if (buffer_.size() < 8 + padded) break;
+            f.body = nlohmann::json::parse(buffer_.begin() + 8, buffer_.begin() + 8 + length);
+            buffer_.erase(buffer_.begin(), buffer_.begin() + 8 + padded);
+            frames.push_back(std::move(f));
+        }
+        return frames;
+    }
+
+    // 연결 이벤트 (handle_event 로 직접 전달)
+    Event event(MainEventType main_type, uint16_t sub_type, const std::string& data = "") const {
+        Event ev;
+        ev.main_type = main_type;
+        ev.sub_type = sub_type;
+        ev.connection = conn;
+        ev.data.assign(data.begin(), data.end());
+        return ev;
+    }
+
+    std::shared_ptr<Connection> conn;
+    std::shared_ptr<Player> player;
+
+private:
+    boost::asio::io_context& io_;
+    tcp::socket socket_;
+    std::vector<char> buffer_;
+};
+
+inline std::vector<Frame> frames_of(const std::vector<Frame>& frames, uint16_t sub_type)
+{
+    std::vector<Frame> result;
+    for (const auto& f : frames) {
+        if (f.sub_type == sub_type) result.push_back(f);
+    }
+    return result;
+}
+
+inline std::vector<Frame> frames_of(const std::vector<Frame>& frames, GameSubType sub_type)
+{
+    return frames_of(frames, static_cast<uint16_t>(sub_type));
+}
+
+inline Event game_event(GameSubType sub_type, uint64_t room_id = 0)
+{
+    Event ev;
+    ev.main_type = MainEventType::GAME;
+    ev.sub_type = static_cast<uint16_t>(sub_type);
+    ev.room_id = room_id;
+    return ev;
+}
+
+// 테스트용 고정 맵 시드 (무작위 맵 생성의 재시도 초과로 테스트가 흔들리지 않도록)
+constexpr uint32_t kMapSeed = 20240601;
+
+// 2인 방 설정 (고정 맵 / 방 정리 타이머 없음 → ROOM_REAP 은 테스트가 직접 전달)
+inline ServerConfig two_player_config()
+{
+    ServerConfig config;
+    config.map_seed = kMapSeed;
+    config.room_size = 2;
+    config.min_room_fill = 2;
+    config.room_reap_interval_ms = 0;
+    return config;
+}
+
+// 대기열 등록 → MATCHMAKE 로 방 하나 생성 (config.room_size == 클라이언트 수 가정)
+inline std::shared_ptr<Room> make_room(GameManager& gm, GameEventHandler& handler,
+                                       const std::vector<TestClient*>& clients)
+{
+    for (auto* c : clients) {
+        gm.add_waiting_player(c->player);
+    }
+    handler.handle_event(game_event(GameSubType::MATCHMAKE));
+    auto rooms = gm.get_all_rooms();
+    return rooms.empty() ? nullptr : rooms.back();
+}
+
+// pos 에서 한 칸 이동 가능한 칸 (없으면 pos)
+inline Point open_neighbor(const Map& map, const Point& pos)
+{
+    const Point dirs[] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+    for (const auto& d : dirs) {
+        Point next{pos.x + d.x, pos.y + d.y};
+        if (map.is_valid_position(next)) return next;
+    }
+    return pos;
+}
+
+// from → to 한 칸씩 이동 경로 (BFS, from 제외 / 도달 불가면 빈 경로)
+inline std::vector<Point> find_path(const Map& map, const Point& from, const Point& to)
+{
+    auto key = [](const Point& p) { return std::make_pair(p.x, p.y); };
+    std::map<std::pair<int, int>, Point> prev;
+    std::queue<Point> q;
+    q.push(from);
+    prev[key(from)] = from;
+    const Point dirs[] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+    while (!q.empty()) {
+        Point cur = q.front();
+        q.pop();
+        if (cur == to) break;
+        for (const auto& d : dirs) {
+            Point next{cur.x + d.x, cur.y + d.y};
+            if (!map.is_valid_position(next) || prev.count(key(next))) continue;
+            prev[key(next)] = cur;
+            q.push(next);
+        }
+    }
+    std::vector<Point> path;
+    if (!prev.count(key(to))) return path;
+    for (Point p = to; !(p == from); p = prev[key(p)]) {
+        path.insert(path.begin(), p);
+    }
+    return path;
+}
+
+// 클라이언트가 보내는 PLAYER_MOVED body (슬롯에 쌓이는 원본 입력)
+inline RawMoveInput move_input(const Point& pos, uint32_t seq = 0)
+{
+    std::string body = nlohmann::json{{"x", pos.x}, {"y", pos.y}, {"seq", seq}}.dump();
+    return RawMoveInput(body.begin(), body.end());
+}
+
+// 이동 입력을 슬롯에 넣고 PLAYER_MOVED 처리
+inline void move(GameEventHandler& handler, TestClient& client, const Point& pos, uint32_t seq = 0)
+{
+    client.player->move_slot_.push(move_input(pos, seq));
+    handler.handle_event(client.event(MainEventType::GAME, static_cast<uint16_t>(GameSubType::PLAYER_MOVED)));
+}
+
+} // namespace test_support
+
+#endif // HANDLER_TEST_SUPPORT_HPP
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "admin_server.hpp"
+#include "profiled_mutex.hpp"
+#include <nlohmann/json.hpp>
+
+/**
+ * 리슨 없이 경로별 응답 확인: 설정 / 방 목록 / 알 수 없는 경로
+ */
+TEST(AdminServerTest, BuildsResponses) {
+    ServerConfig config;
+    config.admin_port = 19090;
+    GameManager gm(config);
+    ThreadPool pool(1);
+    AdminServer admin(config, gm, pool);
+
+    auto cfg = admin.build_response("/config");
+    EXPECT_EQ(cfg.status, 200);
+    EXPECT_EQ(nlohmann::json::parse(cfg.body)["admin_port"], 19090);
+
+    gm.create_room();
+    auto rooms = nlohmann::json::parse(admin.build_response("/rooms").body);
+    EXPECT_EQ(rooms["count"], 1);
+    EXPECT_EQ(rooms["rooms"][0]["present"], 0);
+
+    EXPECT_EQ(admin.build_response("/nope").status, 404);
+}
+
+/**
+ * 상태를 바꾸는 경로는 POST 만 받고 (GET 은 405 + Allow: POST, 상태 변화 없음),
+ * 조회 경로는 GET 만 받는지 확인
+ */
+TEST(AdminServerTest, ControlEndpointsRequirePost) {
+    ServerConfig config;
+    GameManager gm(config);
+    ThreadPool pool(1);
+    AdminServer admin(config, gm, pool);
+
+    ProfiledMutex::set_enabled(false);
+    auto get = admin.build_response("/locks/start", "GET");
+    EXPECT_EQ(get.status, 405);
+    EXPECT_EQ(get.allow, "POST");
+    EXPECT_FALSE(ProfiledMutex::enabled());
+
+    EXPECT_EQ(admin.build_response("/locks/start", "POST").status, 200);
+    EXPECT_TRUE(ProfiledMutex::enabled());
+    EXPECT_EQ(admin.build_response("/locks/stop", "POST").status, 200);
+    EXPECT_FALSE(ProfiledMutex::enabled());
+
+    EXPECT_EQ(admin.build_response("/profile/start?seconds=1", "GET").status, 405);
+    EXPECT_EQ(admin.build_response("/trace/stop", "GET").status, 405);
+
+    auto post_view = admin.build_response("/rooms", "POST");
+    EXPECT_EQ(post_view.status, 405);
+    EXPECT_EQ(post_view.allow, "GET");
+    EXPECT_EQ(admin.build_response("/locks", "GET").status, 200);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "handler_test_support.hpp"
+#include "utils.hpp"
+#include "metrics.hpp"
+#include <algorithm>
+
+using namespace test_support;
+
+/**
+ * 플레이어 송신 세션: 등록 중에는 캐시된 커넥션으로 바로 전송,
+ * 커넥션 해제 후에는 비워져 전송하지 않음 (Player 는 커넥션을 소유하지 않음)
+ */
+TEST(ConnectionManagerTest, PlayerSendsUntilConnectionRemoved) {
+    init_runtime();
+    boost::asio::io_context io;
+    TestClient a(io, "a");
+    auto& cm = ConnectionManager::get_instance();
+
+    EXPECT_EQ(a.player->get_connection(), a.conn);
+    EXPECT_EQ(cm.get_player_for_connection(a.conn), a.player);
+    EXPECT_EQ(a.conn->get_player(), a.player); // 수신 경로용 캐시
+
+    a.player->send_message(Utils::create_response_string(MainEventType::GAME, 1, "{}"));
+    EXPECT_EQ(a.read_frames().size(), 1u);
+
+    cm.remove_connection(a.conn);
+    EXPECT_EQ(a.player->get_connection(), nullptr);
+    EXPECT_EQ(cm.get_player_for_connection(a.conn), nullptr);
+    EXPECT_EQ(a.conn->get_player(), nullptr);
+
+    a.player->send_message(Utils::create_response_string(MainEventType::GAME, 1, "{}"));
+    EXPECT_TRUE(a.read_frames().empty());
+
+    // 매니저 / Player 모두 놓음 → 닫힌 커넥션과 버퍼는 마지막 소유자(테스트)가 놓을 때 정리
+    EXPECT_EQ(a.conn.use_count(), 1);
+
+    // 다시 등록해도 소유하지 않음
+    cm.add_connection(a.conn);
+    cm.register_connection(a.player, a.conn);
+    EXPECT_EQ(a.player->get_connection(), a.conn);
+    EXPECT_EQ(a.conn->get_player(), a.player);
+    cm.unregister_connection(a.player);
+    EXPECT_EQ(a.conn->get_player(), nullptr);
+    cm.remove_connection(a.conn);
+    EXPECT_EQ(a.conn.use_count(), 1);
+}
+
+/**
+ * 커넥션 목록: add 후 하트비트 점검 대상에 포함, remove 후 제외 (플레이어 매핑도 함께 해제)
+ */
+TEST(ConnectionManagerTest, AddAndRemoveConnection) {
+    init_runtime();
+    boost::asio::io_context io;
+    TestClient a(io, "a");
+    auto& cm = ConnectionManager::get_instance();
+    auto contains = [&](const std::shared_ptr<Connection>& conn) {
+        auto all = cm.get_all_connections();
+        return std::find(all.begin(), all.end(), conn) != all.end();
+    };
+
+    auto& active_players = MetricsRegistry::get_instance().gauge("asio_server_active_players", "Players bound to a connection");
+    EXPECT_TRUE(contains(a.conn));
+    EXPECT_EQ(cm.get_connection_for_player(a.player), a.conn);
+    const int64_t players_before = active_players.value();
+
+    // unregister_connection 없이 바로 remove 해도 플레이어 슬롯까지 해제
+    cm.remove_connection(a.conn);
+    EXPECT_FALSE(contains(a.conn));
+    EXPECT_EQ(cm.get_connection_for_player(a.player), nullptr);
+    EXPECT_EQ(active_players.value(), players_before - 1);
+
+    // 다시 추가해도 플레이어 매핑은 register_connection 전까지 없음
+    cm.add_connection(a.conn);
+    EXPECT_TRUE(contains(a.conn));
+    EXPECT_EQ(cm.get_player_for_connection(a.conn), nullptr);
+}
+
+/**
+ * PING 대기: PONG 이 오거나 응답 한도를 넘길 때까지 새 PING 을 시작하지 않음
+ * (RTT 가 점검 주기보다 길어도 처음 보낸 PING 으로 샘플을 얻음)
+ */
+TEST(ConnectionTest, KeepsOutstandingPingUntilPongOrTimeout) {
+    init_runtime();
+    boost::asio::io_context io;
+    TestClient a(io, "a");
+
+    uint32_t first = a.conn->begin_ping(1000);
+    EXPECT_NE(first, 0u);
+    EXPECT_EQ(a.conn->begin_ping(1000), 0u);
+    EXPECT_TRUE(a.conn->complete_ping(first));
+    EXPECT_TRUE(a.conn->rtt().has_sample());
+    EXPECT_FALSE(a.conn->complete_ping(first)); // 중복 PONG
+
+    // 응답 없이 한도를 넘기면 새 PING, 늦게 온 이전 PONG 은 무시
+    uint32_t second = a.conn->begin_ping(1000);
+    uint32_t third = a.conn->begin_ping(0);
+    EXPECT_EQ(third, second + 1);
+    EXPECT_FALSE(a.conn->complete_ping(second));
+    EXPECT_TRUE(a.conn->complete_ping(third));
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "cpu_profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+// 프로파일에 잡힐 만큼 CPU 사용
+uint64_t burn_cpu(std::chrono::milliseconds duration)
+{
+    volatile uint64_t acc = 0;
+    auto until = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < until) {
+        for (int i = 0; i < 10000; ++i) {
+            acc = acc + static_cast<uint64_t>(i) * 31;
+        }
+    }
+    return acc;
+}
+
+} // namespace
+
+/**
+ * CPU 를 쓰는 동안 샘플이 모이고,
+ * 파일이 gperftools 형식 헤더(0, 3, 0, 주기, 0)로 시작하는지 확인
+ */
+TEST(CpuProfilerTest, WritesLegacyPprofProfile) {
+    auto& profiler = CpuProfiler::get_instance();
+    const std::string path = ::testing::TempDir() + "test_cpu_profiler.prof";
+
+    ASSERT_TRUE(profiler.start(path, 10000, 1000));
+    EXPECT_FALSE(profiler.start(path, 10000, 1000)); // 동시에 하나만
+    burn_cpu(std::chrono::milliseconds(300));
+    profiler.stop();
+
+    auto status = profiler.status();
+    EXPECT_FALSE(status.running);
+    EXPECT_TRUE(status.written);
+    EXPECT_GT(status.samples, 10u);
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uintptr_t> header(5);
+    in.read(reinterpret_cast<char*>(header.data()), header.size() * sizeof(uintptr_t));
+    ASSERT_TRUE(in);
+    EXPECT_EQ(header[0], 0u);
+    EXPECT_EQ(header[1], 3u);
+    EXPECT_EQ(header[2], 0u);
+    EXPECT_EQ(header[3], 1000u); // 1000Hz → 1000us
+    EXPECT_EQ(header[4], 0u);
+
+    // 첫 레코드: 샘플 수 > 0, 깊이 1 이상
+    uintptr_t count = 0, depth = 0;
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    in.read(reinterpret_cast<char*>(&depth), sizeof(depth));
+    EXPECT_GT(count, 0u);
+    EXPECT_GT(depth, 0u);
+    std::remove(path.c_str());
+}
+
+/**
+ * 스택 범위를 기록한 스레드는 프레임 포인터 체인을 따라 호출자까지 잡히는지 확인
+ * (burn_cpu → 테스트 본문 → gtest ..., 깊이 2 이상인 레코드가 있어야 함)
+ */
+TEST(CpuProfilerTest, WalksFramePointersOfRegisteredThread) {
+    CpuProfiler::register_thread();
+    auto& profiler = CpuProfiler::get_instance();
+    const std::string path = ::testing::TempDir() + "test_cpu_profiler_stack.prof";
+
+    ASSERT_TRUE(profiler.start(path, 10000, 1000));
+    burn_cpu(std::chrono::milliseconds(300));
+    profiler.stop();
+    ASSERT_TRUE(profiler.status().written);
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uintptr_t> header(5);
+    in.read(reinterpret_cast<char*>(header.data()), header.size() * sizeof(uintptr_t));
+    ASSERT_TRUE(in);
+
+    uintptr_t max_depth = 0;
+    while (true) {
+        uintptr_t count = 0, depth = 0;
+        in.read(reinterpret_cast<char*>(&count), sizeof(count));
+        in.read(reinterpret_cast<char*>(&depth), sizeof(depth));
+        if (!in || (count == 0 && depth == 1)) {
+            break; // 끝 표시 (0, 1, 0)
+        }
+        ASSERT_LE(depth, static_cast<uintptr_t>(CpuProfiler::kMaxDepth));
+        max_depth = std::max(max_depth, depth);
+        in.seekg(static_cast<std::streamoff>(depth * sizeof(uintptr_t)), std::ios::cur);
+    }
+    EXPECT_GE(max_depth, 2u);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,352 @@
+#include <gtest/gtest.h>
+#include "handler_test_support.hpp"
+#include "metrics.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+
+using namespace test_support;
+
+/**
+ * 틱 모드: 이동은 즉시 브로드캐스트하지 않고, GAME_TICK 마다 맵 변경분 스냅샷 1개로 전송
+ * (변경이 없는 틱은 아무것도 보내지 않음)
+ */
+TEST(GameEventHandlerTest, TickSendsChangedPlayersOnce) {
+    init_runtime();
+    auto config = two_player_config();
+    config.tick_interval_ms = 50;
+    boost::asio::io_context io;
+    GameManager gm(config);
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, handler, {&a, &b});
+    ASSERT_TRUE(room);
+    ASSERT_TRUE(room->is_tick_mode());
+    a.read_frames();
+    b.read_frames();
+
+    auto map_a = room->get_map_by_name("A");
+    Point next = open_neighbor(*map_a, room->player_position(*a.player));
+    move(handler, a, next, 1);
+    EXPECT_TRUE(frames_of(b.read_frames(), GameSubType::PLAYER_MOVED).empty());
+
+    // 틱 1: 두 플레이어 모두 a 의 위치 (a 에게는 seq ack 포함)
+    handler.handle_event(game_event(GameSubType::GAME_TICK, room->id_));
+    for (auto* c : {&a, &b}) {
+        auto snaps = frames_of(c->read_frames(), GameSubType::GAME_TICK);
+        ASSERT_EQ(snaps.size(), 1u);
+        ASSERT_EQ(snaps[0].body["players"].size(), 1u);
+        EXPECT_EQ(snaps[0].body["players"][0]["player_id"], a.player->id_);
+        EXPECT_EQ(snaps[0].body["players"][0]["x"], next.x);
+        EXPECT_EQ(snaps[0].body["players"][0]["seq"], 1);
+    }
+
+    // 틱 2: 변경 없음 → 전송 없음
+    handler.handle_event(game_event(GameSubType::GAME_TICK, room->id_));
+    EXPECT_TRUE(frames_of(a.read_frames(), GameSubType::GAME_TICK).empty());
+    EXPECT_TRUE(frames_of(b.read_frames(), GameSubType::GAME_TICK).empty());
+}
+
+/**
+ * 포탈에 닿은 뒤의 입력은 이전 맵 기준이므로 버려지고,
+ * 예측 이동을 되돌리도록 마지막 적용 seq + 버린 seq 가 담긴 보정이 전송되는지 확인
+ */
+TEST(GameEventHandlerTest, InputsAfterPortalAreCorrected) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, handler, {&a, &b});
+    ASSERT_TRUE(room);
+    a.read_frames();
+
+    auto map_a = room->get_map_by_name("A");
+    ASSERT_FALSE(map_a->portals_.empty());
+    auto path = find_path(*map_a, room->player_position(*a.player), map_a->portals_[0].position);
+    ASSERT_FALSE(path.empty());
+
+    a.player->move_slot_.set_max_pending(path.size() + 1);
+    uint32_t seq = 0;
+    for (const auto& p : path) {
+        a.player->move_slot_.push(move_input(p, ++seq));
+    }
+    const uint32_t portal_seq = seq;
+    a.player->move_slot_.push(move_input(open_neighbor(*map_a, path.back()), ++seq));
+    handler.handle_event(a.event(MainEventType::GAME, static_cast<uint16_t>(GameSubType::PLAYER_MOVED)));
+
+    EXPECT_EQ(a.player->current_map()->name, "B");
+    auto errors = frames_of(a.read_frames(), static_cast<uint16_t>(ErrorSubType::UNKNOWN));
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].body["seq"], portal_seq);
+    EXPECT_EQ(errors[0].body["rejected_seq"], seq);
+}
+
+/**
+ * 관심 영역 + 포탈: 새 맵 시작 위치를 시야에 둔 플레이어만 player_come_in_map 을 받고,
+ * 들어온 본인에게는 시야 안의 플레이어 위치만 전송되는지 확인
+ */
+TEST(GameEventHandlerTest, PortalEntryRespectsInterest) {
+    init_runtime();
+    boost::asio::io_context io;
+    auto config = two_player_config();
+    config.room_size = 3;
+    config.min_room_fill = 3;
+    config.view_radius = 2;
+    GameManager gm(config);
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b"), c(io, "c");
+
+    auto room = make_room(gm, handler, {&a, &b, &c});
+    ASSERT_TRUE(room);
+
+    auto map_a = room->get_map_by_name("A");
+    auto map_b = room->get_map_by_name("B");
+    ASSERT_TRUE(map_b && map_b->has_interest_management());
+    const Point start = map_b->start_point;
+
+    // b 는 B 시작 위치 옆, c 는 시야 밖으로 옮겨둠
+    Point near = open_neighbor(*map_b, start);
+    Point far = start;
+    for (int y = 0; y < map_b->max_height && far == start; ++y) {
+        for (int x = 0; x < map_b->max_width; ++x) {
+            Point pt{x, y};
+            if (map_b->is_valid_position(pt) && std::max(std::abs(x - start.x), std::abs(y - start.y)) > config.view_radius) {
+                far = pt;
+                break;
+            }
+        }
+    }
+    ASSERT_NE(near, start);
+    ASSERT_NE(far, start);
+    for (auto [client, pos] : {std::make_pair(&b, near), std::make_pair(&c, far)}) {
+        map_a->remove_player(client->player);
+        map_b->add_player(client->player, pos);
+        client->player->set_current_map(map_b);
+        room->record_player_move(*client->player, *map_b, pos, 0, 0, false);
+    }
+
+    auto path = find_path(*map_a, room->player_position(*a.player), map_a->portals_[0].position);
+    ASSERT_FALSE(path.empty());
+    a.player->move_slot_.set_max_pending(path.size());
+    for (const auto& p : path) {
+        a.player->move_slot_.push(move_input(p, 0));
+    }
+    a.read_frames();
+    b.read_frames();
+    c.read_frames();
+    handler.handle_event(a.event(MainEventType::GAME, static_cast<uint16_t>(GameSubType::PLAYER_MOVED)));
+    ASSERT_EQ(a.player->current_map()->name, "B");
+
+    const auto come_in = GameSubType::PLAYER_COME_IN_MAP;
+    auto seen_by_a = frames_of(a.read_frames(), come_in);
+    ASSERT_EQ(seen_by_a.size(), 1u);
+    std::set<std::string> visible;
+    for (auto& p : seen_by_a[0].body["players"]) {
+        visible.insert(p["player_id"].get<std::string>());
+    }
+    EXPECT_EQ(visible, (std::set<std::string>{a.player->id_, b.player->id_}));
+
+    auto seen_by_b = frames_of(b.read_frames(), come_in);
+    ASSERT_EQ(seen_by_b.size(), 1u);
+    ASSERT_EQ(seen_by_b[0].body["players"].size(), 1u);
+    EXPECT_EQ(seen_by_b[0].body["players"][0]["player_id"], a.player->id_);
+
+    EXPECT_TRUE(frames_of(c.read_frames(), come_in).empty());
+}
+
+/**
+ * 즉시 모드 + seq: 본인에게는 이동 에코 대신 seq 만 담은 move_ack 하나,
+ * 다른 플레이어에게는 seq 없는 player_moved 가 가는지 확인
+ */
+TEST(GameEventHandlerTest, ImmediateMoveAcksSeqOnlyToMover) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, handler, {&a, &b});
+    ASSERT_TRUE(room);
+    ASSERT_FALSE(room->uses_snapshots());
+    a.read_frames();
+    b.read_frames();
+
+    auto map_a = room->get_map_by_name("A");
+    Point next = open_neighbor(*map_a, room->player_position(*a.player));
+    move(handler, a, next, 3);
+
+    auto acks = frames_of(a.read_frames(), GameSubType::PLAYER_MOVED);
+    ASSERT_EQ(acks.size(), 1u);
+    EXPECT_EQ(acks[0].body["action"], "move_ack");
+    EXPECT_EQ(acks[0].body["seq"], 3);
+    EXPECT_FALSE(acks[0].body.contains("player_id"));
+
+    auto moved = frames_of(b.read_frames(), GameSubType::PLAYER_MOVED);
+    ASSERT_EQ(moved.size(), 1u);
+    EXPECT_EQ(moved[0].body["action"], "player_moved");
+    EXPECT_EQ(moved[0].body["player_id"], a.player->id_);
+    EXPECT_EQ(moved[0].body["x"], next.x);
+    EXPECT_FALSE(moved[0].body.contains("seq"));
+}
+
+/**
+ * 슬롯이 가득 차면 새 입력만 버려지고, 보관된 경로는 그대로 적용되는지 확인
+ * (파싱 실패 입력은 워커에서 건너뜀, 버린 입력 뒤의 입력은 보정으로 거절)
+ */
+TEST(GameEventHandlerTest, FullMoveSlotAppliesKeptPath) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, handler, {&a, &b});
+    ASSERT_TRUE(room);
+    a.read_frames();
+
+    auto map_a = room->get_map_by_name("A");
+    auto path = find_path(*map_a, room->player_position(*a.player), map_a->portals_[0].position);
+    ASSERT_GE(path.size(), 4u);
+
+    a.player->move_slot_.set_max_pending(3);
+    const std::string garbage = "not json";
+    a.player->move_slot_.push(RawMoveInput(garbage.begin(), garbage.end()));
+    a.player->move_slot_.push(move_input(path[0], 1));
+    a.player->move_slot_.push(move_input(path[1], 2));
+    a.player->move_slot_.push(move_input(path[2], 3)); // 가득 참 → 버려짐
+    EXPECT_EQ(a.player->move_slot_.dropped_count(), 1u);
+    handler.handle_event(a.event(MainEventType::GAME, static_cast<uint16_t>(GameSubType::PLAYER_MOVED)));
+
+    EXPECT_EQ(room->player_position(*a.player), path[1]);
+    auto moved = frames_of(a.read_frames(), GameSubType::PLAYER_MOVED);
+    ASSERT_EQ(moved.size(), 1u);
+    EXPECT_EQ(moved[0].body["seq"], 2);
+
+    // 버린 칸을 건너뛴 다음 입력은 거절 + 보정
+    move(handler, a, path[3], 4);
+    EXPECT_EQ(room->player_position(*a.player), path[1]);
+    auto errors = frames_of(a.read_frames(), static_cast<uint16_t>(ErrorSubType::UNKNOWN));
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].body["seq"], 2);
+    EXPECT_EQ(errors[0].body["rejected_seq"], 4);
+}
+
+/**
+ * 시뮬레이션 스텝: 스텝 중 생긴 통지(거절 보정, 맵 이동, 지형)는 바로 보내지 않고
+ * 스텝 끝에 수신자당 한 번의 쓰기로 전송되는지 확인
+ */
+TEST(GameEventHandlerTest, SimulationStepFlushesOncePerRecipient) {
+    init_runtime();
+    auto config = two_player_config();
+    config.simulation_step_ms = 50;
+    config.terrain_chunk_size = 4;
+    boost::asio::io_context io;
+    GameManager gm(config);
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, handler, {&a, &b});
+    ASSERT_TRUE(room);
+    ASSERT_TRUE(room->is_simulation_mode());
+    a.read_frames();
+    b.read_frames();
+
+    // a: 포탈까지 이동 + 이후 입력 1개 (버려지고 보정) / b: 제자리 입력 (거절)
+    auto map_a = room->get_map_by_name("A");
+    auto path = find_path(*map_a, room->player_position(*a.player), map_a->portals_[0].position);
+    ASSERT_FALSE(path.empty());
+    a.player->move_slot_.set_max_pending(path.size() + 1);
+    uint32_t seq = 0;
+    for (const auto& p : path) {
+        EXPECT_FALSE(a.player->move_slot_.push(move_input(p, ++seq)));
+    }
+    a.player->move_slot_.push(move_input(open_neighbor(*map_a, path.back()), ++seq));
+    b.player->move_slot_.push(move_input(room->player_position(*b.player), 1));
+    EXPECT_EQ(a.conn->pending_write_count(), 0u);
+    EXPECT_EQ(b.conn->pending_write_count(), 0u);
+    auto& frames_out = MetricsRegistry::get_instance().counter("asio_server_frames_out_total", "Frames written to clients");
+    const uint64_t frames_before = frames_out.value();
+
+    handler.handle_event(game_event(GameSubType::SIMULATION_STEP, room->id_));
+    EXPECT_EQ(a.conn->pending_write_count(), 1u);
+    EXPECT_EQ(b.conn->pending_write_count(), 1u);
+
+    auto frames_a = a.read_frames();
+    EXPECT_EQ(frames_of(frames_a, static_cast<uint16_t>(ErrorSubType::UNKNOWN)).size(), 1u);
+    EXPECT_EQ(frames_of(frames_a, GameSubType::PLAYER_COME_IN_MAP).size(), 1u);
+    auto terrain = frames_of(frames_a, GameSubType::TERRAIN_CHUNK);
+    ASSERT_FALSE(terrain.empty());
+    EXPECT_EQ(terrain.back().body["map"], "B");
+
+    auto frames_b = b.read_frames();
+    auto rejected = frames_of(frames_b, static_cast<uint16_t>(ErrorSubType::UNKNOWN));
+    ASSERT_EQ(rejected.size(), 1u);
+    EXPECT_EQ(rejected[0].body["rejected_seq"], 1);
+    EXPECT_EQ(frames_of(frames_b, GameSubType::PLAYER_COME_OUT_MAP).size(), 1u);
+
+    // 송신 프레임 지표는 쓰기 횟수가 아닌 프로토콜 프레임 수
+    EXPECT_EQ(frames_out.value() - frames_before, frames_a.size() + frames_b.size());
+
+    // 입력이 없는 스텝: 전송 없음
+    handler.handle_event(game_event(GameSubType::SIMULATION_STEP, room->id_));
+    EXPECT_EQ(a.conn->pending_write_count(), 0u);
+    EXPECT_EQ(b.conn->pending_write_count(), 0u);
+}
+
+/**
+ * 방 정리: 플레이어가 있는 방 / 입장 전 (미공개) 방은 남기고, 모두 빠진 방은 제거,
+ * 최대 게임 시간을 넘긴 방은 GAME_END("timeout") 요청
+ */
+TEST(GameEventHandlerTest, RoomReapRemovesEmptyAndTimesOut) {
+    init_runtime();
+    auto config = two_player_config();
+    config.max_game_duration_ms = 200;
+    boost::asio::io_context io;
+    GameManager gm(config);
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b"), c(io, "c"), d(io, "d");
+
+    auto playing = make_room(gm, handler, {&a, &b});
+    auto abandoned = make_room(gm, handler, {&c, &d});
+    ASSERT_TRUE(playing && abandoned);
+    abandoned->remove_player(c.player);
+    abandoned->remove_player(d.player);
+    auto joining = gm.reserve_room(); // 아직 입장 전 (미공개)
+
+    // 클라이언트가 보낸 ROOM_REAP 은 무시 (점검도, 재예약도 하지 않음)
+    handler.handle_event(a.event(MainEventType::GAME, static_cast<uint16_t>(GameSubType::ROOM_REAP)));
+    EXPECT_EQ(gm.find_room(abandoned->id_), abandoned);
+
+    handler.handle_event(game_event(GameSubType::ROOM_REAP));
+    EXPECT_EQ(gm.find_room(playing->id_), playing);
+    EXPECT_EQ(gm.find_room(abandoned->id_), nullptr);
+    gm.publish_room(joining);
+    EXPECT_EQ(gm.find_room(joining->id_), joining);
+    gm.remove_room(joining->id_);
+    EXPECT_FALSE(playing->is_ending()); // 시간 초과 전 → GAME_END 요청 없음
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(config.max_game_duration_ms + 10));
+    handler.handle_event(game_event(GameSubType::ROOM_REAP));
+    EXPECT_TRUE(playing->is_ending());
+    EXPECT_EQ(gm.find_room(playing->id_), playing); // 제거는 GAME_END 처리에서
+}
+
+/**
+ * 내부 이벤트(MATCHMAKE)를 클라이언트가 보내면 무시: 방을 편성하지 않고 대기열도 그대로
+ */
+TEST(GameEventHandlerTest, IgnoresInternalEventFromClient) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler handler(gm, io);
+    TestClient a(io, "a"), b(io, "b");
+
+    gm.add_waiting_player(a.player);
+    gm.add_waiting_player(b.player);
+    handler.handle_event(a.event(MainEventType::GAME, static_cast<uint16_t>(GameSubType::MATCHMAKE)));
+    EXPECT_TRUE(gm.get_all_rooms().empty());
+    EXPECT_EQ(gm.waiting_count(), 2u);
+}
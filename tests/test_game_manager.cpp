@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include "game_manager.hpp"
+
+/**
+ * 미공개 방: id 는 확보되지만 publish_room 전에는 조회 / 목록 / 방 정리 대상이 아님
+ */
+TEST(GameManagerTest, ReservedRoomHiddenUntilPublished) {
+    GameManager gm;
+    auto room = gm.reserve_room();
+    ASSERT_TRUE(room);
+    EXPECT_EQ(gm.find_room(room->id_), nullptr);
+    EXPECT_TRUE(gm.get_all_rooms().empty());
+    EXPECT_TRUE(gm.next_rooms_to_check(10).empty());
+
+    gm.publish_room(room);
+    EXPECT_EQ(gm.find_room(room->id_), room);
+    EXPECT_EQ(gm.get_all_rooms().size(), 1u);
+    EXPECT_EQ(gm.next_rooms_to_check(10).size(), 1u);
+
+    // 미공개 상태에서 제거해도 슬롯이 남지 않음
+    auto hidden = gm.reserve_room();
+    gm.remove_room(hidden->id_);
+    gm.publish_room(hidden);
+    EXPECT_EQ(gm.find_room(hidden->id_), nullptr);
+    EXPECT_EQ(gm.get_all_rooms().size(), 1u);
+}
+
+/**
+ * 방 정리 커서: 한 번에 count 개씩 이어서 순회하고, 끝에 닿으면 처음부터 (빈 슬롯은 건너뜀)
+ */
+TEST(GameManagerTest, NextRoomsToCheckWrapsAround) {
+    GameManager gm;
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 5; ++i) {
+        ids.push_back(gm.create_room()->id_);
+    }
+    gm.remove_room(ids[2]);
+
+    auto ids_of = [](const std::vector<std::shared_ptr<Room>>& rooms) {
+        std::vector<uint64_t> result;
+        for (auto& r : rooms) result.push_back(r->id_);
+        return result;
+    };
+    EXPECT_EQ(ids_of(gm.next_rooms_to_check(2)), (std::vector<uint64_t>{ids[0], ids[1]}));
+    EXPECT_EQ(ids_of(gm.next_rooms_to_check(2)), (std::vector<uint64_t>{ids[3], ids[4]}));
+    EXPECT_EQ(ids_of(gm.next_rooms_to_check(3)), (std::vector<uint64_t>{ids[0], ids[1], ids[3]}));
+
+    // 요청 수가 방 수보다 많아도 한 바퀴만
+    EXPECT_EQ(gm.next_rooms_to_check(10).size(), 4u);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "logger.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * 런타임 레벨 미만 로그는 포맷팅(인자 평가)도 하지 않고,
+ * 레벨 이상 로그만 flush 후 파일에 기록되는지 확인
+ */
+TEST(LoggerTest, FiltersByLevelAndWritesToFile) {
+    const std::string path = "test_logger_output.log";
+    std::remove(path.c_str());
+
+    auto& logger = Logger::get_instance();
+    ASSERT_TRUE(logger.set_output_file(path));
+    logger.set_level(LogLevel::INFO);
+
+    int evaluated = 0;
+    auto count = [&]() { return ++evaluated; };
+    LOG_DEBUG("hidden " << count());
+    LOG_INFO("visible " << count());
+    LOG_WARN("warn line");
+    logger.flush();
+
+    EXPECT_EQ(evaluated, 1);
+
+    std::ifstream ifs(path);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    const std::string out = ss.str();
+    EXPECT_EQ(out.find("hidden"), std::string::npos);
+    EXPECT_NE(out.find("[INFO]"), std::string::npos);
+    EXPECT_NE(out.find("visible 1"), std::string::npos);
+    EXPECT_NE(out.find("[WARN]"), std::string::npos);
+
+    ASSERT_TRUE(logger.set_output_file(""));
+    std::remove(path.c_str());
+}
+
+/**
+ * 인자 평가 중에 다른 로그를 남겨도 (중첩 로그) 두 줄이 섞이지 않고 각각 온전히 기록되는지 확인
+ */
+TEST(LoggerTest, NestedLogDuringFormatting) {
+    const std::string path = "test_logger_nested.log";
+    std::remove(path.c_str());
+
+    auto& logger = Logger::get_instance();
+    ASSERT_TRUE(logger.set_output_file(path));
+    logger.set_level(LogLevel::INFO);
+
+    auto inner = []() {
+        LOG_INFO("inner line");
+        return 42;
+    };
+    LOG_INFO("outer before " << inner() << " after");
+    logger.flush();
+
+    std::ifstream ifs(path);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(ifs, line);) {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_NE(lines[0].find("] (t"), std::string::npos);
+    EXPECT_EQ(lines[0].substr(lines[0].size() - 10), "inner line");
+    EXPECT_EQ(lines[1].substr(lines[1].find(") ") + 2), "outer before 42 after");
+
+    ASSERT_TRUE(logger.set_output_file(""));
+    std::remove(path.c_str());
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "matchmaker.hpp"
+
+namespace {
+std::vector<std::shared_ptr<Player>> make_players(int count) {
+    std::vector<std::shared_ptr<Player>> players;
+    for (int i = 0; i < count; ++i) {
+        players.push_back(std::make_shared<Player>("p" + std::to_string(i)));
+    }
+    return players;
+}
+} // namespace
+
+/**
+ * 한 번의 편성에서 꽉 찬 방을 여러 개 만들고,
+ * 남은 인원은 최대 대기 시간이 지난 뒤에만 최소 인원으로 편성되는지 확인
+ */
+TEST(MatchmakerTest, FormsFullRoomsThenPartialAfterWait) {
+    Matchmaker::Options options;
+    options.room_size = 3;
+    options.min_fill = 2;
+    options.max_wait_ms = 1000;
+    Matchmaker mm(options);
+
+    auto t0 = Matchmaker::Clock::now();
+    auto players = make_players(8);
+    for (auto& p : players) {
+        ASSERT_TRUE(mm.enqueue(p, 0, t0));
+    }
+    EXPECT_FALSE(mm.enqueue(players[0], 0, t0));
+
+    // 중간 이탈 (O(1) 제거)
+    EXPECT_TRUE(mm.remove(players[7]));
+    EXPECT_FALSE(mm.remove(players[7]));
+
+    auto groups = mm.form_groups(t0);
+    ASSERT_EQ(groups.size(), 2u);
+    EXPECT_EQ(groups[0].players.front(), players[0]);
+    EXPECT_EQ(groups[1].players.size(), 3u);
+    EXPECT_EQ(mm.size(), 1u);
+
+    // 1명은 최소 인원 미달 → 대기 시간이 지나도 편성되지 않음
+    EXPECT_TRUE(mm.form_groups(t0 + std::chrono::seconds(2)).empty());
+
+    mm.enqueue(players[7], 0, t0 + std::chrono::milliseconds(1500));
+    EXPECT_TRUE(mm.form_groups(t0 + std::chrono::milliseconds(1500)).size() == 1u);
+    EXPECT_EQ(mm.size(), 0u);
+}
+
+/**
+ * RTT 버킷: 같은 구간끼리 먼저 편성하고,
+ * 대기 시간을 넘긴 플레이어는 구간과 관계없이 묶는지 확인
+ */
+TEST(MatchmakerTest, BucketsByRtt) {
+    Matchmaker::Options options;
+    options.room_size = 2;
+    options.min_fill = 2;
+    options.max_wait_ms = 1000;
+    options.rtt_bucket_ms = 50;
+    Matchmaker mm(options);
+
+    auto t0 = Matchmaker::Clock::now();
+    auto players = make_players(3);
+    mm.enqueue(players[0], 10, t0);
+    mm.enqueue(players[1], 200, t0);
+    mm.enqueue(players[2], 20, t0);
+
+    auto groups = mm.form_groups(t0);
+    ASSERT_EQ(groups.size(), 1u);
+    EXPECT_EQ(groups[0].players[0], players[0]);
+    EXPECT_EQ(groups[0].players[1], players[2]);
+
+    auto late = make_players(1);
+    mm.enqueue(late[0], 400, t0);
+    EXPECT_TRUE(mm.form_groups(t0).empty());
+    groups = mm.form_groups(t0 + std::chrono::seconds(1));
+    ASSERT_EQ(groups.size(), 1u);
+    EXPECT_EQ(groups[0].players.size(), 2u);
+}
+
+/**
+ * 편성된 묶음은 등록 시각을 함께 돌려주고,
+ * 그 시각으로 되돌리면 나중에 들어온 플레이어보다 앞서고 max_wait 경과도 유지되는지 확인
+ */
+TEST(MatchmakerTest, RequeueKeepsEnqueueTime) {
+    Matchmaker::Options options;
+    options.room_size = 3;
+    options.min_fill = 2;
+    options.max_wait_ms = 1000;
+    Matchmaker mm(options);
+
+    auto t0 = Matchmaker::Clock::now();
+    auto players = make_players(3);
+    mm.enqueue(players[0], 0, t0);
+    mm.enqueue(players[1], 0, t0 + std::chrono::milliseconds(100));
+
+    auto groups = mm.form_groups(t0 + std::chrono::seconds(1));
+    ASSERT_EQ(groups.size(), 1u);
+    ASSERT_EQ(groups[0].enqueued_at.size(), 2u);
+    EXPECT_EQ(groups[0].enqueued_at[0], t0);
+    EXPECT_EQ(groups[0].enqueued_at[1], t0 + std::chrono::milliseconds(100));
+
+    // 방 생성 실패 → 나중에 온 플레이어가 먼저 대기 중인 상태에서 원래 시각으로 되돌림
+    const auto t1 = t0 + std::chrono::seconds(1);
+    mm.enqueue(players[2], 0, t1);
+    for (std::size_t i = 0; i < groups[0].players.size(); ++i) {
+        mm.enqueue(groups[0].players[i], 0, groups[0].enqueued_at[i]);
+    }
+    groups = mm.form_groups(t1);
+    ASSERT_EQ(groups.size(), 1u);
+    EXPECT_EQ(groups[0].players, players);
+}
@@ -70,4 +70,62 @@ TEST(MapTest, GenerateRandomObstacles_PathValidation) {
                 << "맵 크기 " << width << "x" << height << "에서 portal로의 경로가 존재하지 않습니다.";
         }
     }
-}
\ No newline at end of file
+}
+/**
+ * 지형 청크 분류: 장애물마다 자신이 속한 청크에만 들어가는지 확인
+ * (20x12 맵, 청크 8 → 3x2 청크, 가장자리 청크는 맵 밖까지 덮음)
+ */
+TEST(MapTest, BuildTerrainChunks) {
+    Map map("T", 20, 12);
+    map.obstacles_.push_back({{0, 0}});
+    map.obstacles_.push_back({{8, 0}});
+    map.obstacles_.push_back({{19, 11}});
+    map.obstacles_.push_back({{7, 8}});
+    map.build_terrain_chunks(8);
+
+    ASSERT_TRUE(map.is_terrain_streaming());
+    ASSERT_EQ(map.terrain_chunk_count(), 6);
+
+    auto obstacles_in = [&](int chunk) {
+        std::set<Point> result;
+        auto info = map.extract_chunk_info(chunk);
+        for (const auto& o : info["obstacles"]) {
+            result.insert({o["x"].get<int>(), o["y"].get<int>()});
+        }
+        return result;
+    };
+    EXPECT_EQ(obstacles_in(0), (std::set<Point>{{0, 0}}));
+    EXPECT_EQ(obstacles_in(1), (std::set<Point>{{8, 0}}));
+    EXPECT_TRUE(obstacles_in(2).empty());
+    EXPECT_EQ(obstacles_in(3), (std::set<Point>{{7, 8}}));
+    EXPECT_TRUE(obstacles_in(4).empty());
+    EXPECT_EQ(obstacles_in(5), (std::set<Point>{{19, 11}}));
+
+    auto info = map.extract_chunk_info(5);
+    EXPECT_EQ(info["x"], 16);
+    EXPECT_EQ(info["y"], 8);
+
+    // 청크 크기 0 → 비활성
+    map.build_terrain_chunks(0);
+    EXPECT_FALSE(map.is_terrain_streaming());
+    EXPECT_EQ(map.terrain_chunk_count(), 0);
+}
+
+/**
+ * 주변 청크: 위치가 속한 청크 + 인접 8개 중 맵 안에 있는 청크만
+ */
+TEST(MapTest, GetChunksAround) {
+    Map map("T", 20, 12);
+    map.build_terrain_chunks(8);
+
+    auto around = [&](const Point& pos) {
+        auto chunks = map.get_chunks_around(pos);
+        return std::set<int>(chunks.begin(), chunks.end());
+    };
+    EXPECT_EQ(around({0, 0}), (std::set<int>{0, 1, 3, 4}));
+    EXPECT_EQ(around({19, 0}), (std::set<int>{1, 2, 4, 5}));
+    EXPECT_EQ(around({9, 9}), (std::set<int>{0, 1, 2, 3, 4, 5}));
+
+    map.build_terrain_chunks(0);
+    EXPECT_TRUE(map.get_chunks_around({0, 0}).empty());
+}
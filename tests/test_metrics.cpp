@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "metrics.hpp"
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/**
+ * 버킷 경계가 연속이고, 기록한 값이 자기 버킷 범위 안에 들어가는지 확인
+ * (상대 오차 12.5% 이내)
+ */
+TEST(MetricsTest, HistogramBucketsCoverValues) {
+    for (int i = 0; i + 1 < Histogram::kBucketCount; ++i) {
+        EXPECT_EQ(Histogram::bucket_upper(i) + 1, Histogram::bucket_lower(i + 1));
+    }
+    for (uint64_t v : {0ull, 1ull, 7ull, 8ull, 15ull, 16ull, 17ull, 1000ull, 123456ull, 1ull << 39}) {
+        int idx = Histogram::bucket_index(v);
+        EXPECT_LE(Histogram::bucket_lower(idx), v);
+        EXPECT_GE(Histogram::bucket_upper(idx), v);
+        EXPECT_LE(Histogram::bucket_upper(idx) - Histogram::bucket_lower(idx), v / 8);
+    }
+
+    Histogram h;
+    for (uint64_t v = 1; v <= 100; ++v) h.record(v);
+    EXPECT_EQ(h.count(), 100u);
+    EXPECT_EQ(h.sum(), 5050u);
+    uint64_t p50 = h.value_at_quantile(0.5);
+    EXPECT_GE(p50, 50u);
+    EXPECT_LE(p50, 56u);
+    EXPECT_EQ(h.count_at_or_below(7), 7u);
+}
+
+/**
+ * Prometheus 텍스트 출력: 같은 이름 + 라벨이면 같은 지표, 히스토그램은 누적 버킷/합계/개수
+ */
+TEST(MetricsTest, RendersPrometheusText) {
+    auto& reg = MetricsRegistry::get_instance();
+    reg.counter("test_frames_total", "frames", "dir=\"in\"").inc(3);
+    reg.counter("test_frames_total", "frames", "dir=\"in\"").inc(2);
+    reg.gauge("test_rooms", "rooms").set(4);
+    reg.histogram("test_latency_us", "latency").record(3);
+
+    const std::string text = reg.render_prometheus();
+    EXPECT_NE(text.find("# TYPE test_frames_total counter\n"), std::string::npos);
+    EXPECT_NE(text.find("test_frames_total{dir=\"in\"} 5\n"), std::string::npos);
+    EXPECT_NE(text.find("test_rooms 4\n"), std::string::npos);
+    EXPECT_NE(text.find("test_latency_us_bucket{le=\"2\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("test_latency_us_bucket{le=\"4\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("test_latency_us_bucket{le=\"+Inf\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("test_latency_us_count 1\n"), std::string::npos);
+
+    EXPECT_THROW(reg.gauge("test_frames_total", "wrong type"), std::invalid_argument);
+}
+
+/**
+ * 16 이상에서는 버킷 폭이 2 이상: le 값과 같은 기록도 누적 개수에 포함되고,
+ * Prometheus 출력의 le 는 실제 버킷 상한 (16 → 17)
+ */
+TEST(MetricsTest, HistogramCountsSampleAtBucketBound) {
+    Histogram h;
+    h.record(15);
+    h.record(16);
+    h.record(18);
+    EXPECT_EQ(h.count_at_or_below(15), 1u);
+    EXPECT_EQ(h.count_at_or_below(16), 2u);
+    EXPECT_EQ(h.count_at_or_below(17), 2u);
+    EXPECT_EQ(h.count_at_or_below(18), 3u);
+
+    auto& reg = MetricsRegistry::get_instance();
+    reg.histogram("test_bound_us", "bound").record(16);
+    const std::string text = reg.render_prometheus();
+    EXPECT_NE(text.find("test_bound_us_bucket{le=\"8\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("test_bound_us_bucket{le=\"17\"} 1\n"), std::string::npos);
+    EXPECT_EQ(text.find("test_bound_us_bucket{le=\"16\"}"), std::string::npos);
+}
+
+/**
+ * 기록 중에 출력해도 le 누적 개수가 줄지 않고, +Inf 와 _count 가 같은 값인지 확인
+ * (누적/개수를 같은 버킷 스냅샷에서 계산)
+ */
+TEST(MetricsTest, HistogramRenderIsConsistentWhileRecording) {
+    auto& reg = MetricsRegistry::get_instance();
+    Histogram& h = reg.histogram("test_concurrent_us", "concurrent");
+
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        uint64_t v = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            h.record(++v % 5000);
+        }
+    });
+
+    for (int round = 0; round < 200; ++round) {
+        std::istringstream text(reg.render_prometheus());
+        std::string line;
+        uint64_t prev = 0, inf = 0, count = 0;
+        bool has_count = false;
+        while (std::getline(text, line)) {
+            auto value = [&] { return std::stoull(line.substr(line.rfind(' ') + 1)); };
+            if (line.rfind("test_concurrent_us_bucket{le=\"+Inf\"}", 0) == 0) {
+                inf = value();
+                EXPECT_LE(prev, inf);
+            } else if (line.rfind("test_concurrent_us_bucket", 0) == 0) {
+                EXPECT_LE(prev, value());
+                prev = value();
+            } else if (line.rfind("test_concurrent_us_count", 0) == 0) {
+                count = value();
+                has_count = true;
+            }
+        }
+        ASSERT_TRUE(has_count);
+        EXPECT_EQ(inf, count);
+    }
+
+    stop = true;
+    writer.join();
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "move_input_slot.hpp"
+#include <string>
+
+namespace {
+
+RawMoveInput raw(const std::string& body)
+{
+    return RawMoveInput(body.begin(), body.end());
+}
+
+std::string body_of(const RawMoveInput& input)
+{
+    return std::string(input.begin(), input.end());
+}
+
+} // namespace
+
+/**
+ * 처리 대기 이벤트가 없을 때만 새 이벤트를 요구하고,
+ * 이후 입력은 같은 슬롯에 경로 순서대로 병합되는지 확인
+ */
+TEST(MoveInputSlotTest, CoalescesWhileScheduled) {
+    MoveInputSlot slot;
+
+    EXPECT_TRUE(slot.push(raw("1")));  // 첫 입력 → 이벤트 필요
+    EXPECT_FALSE(slot.push(raw("2"))); // 대기 중 → 병합
+    EXPECT_FALSE(slot.push(raw("3")));
+
+    std::vector<RawMoveInput> path;
+    ASSERT_TRUE(slot.take(path));
+    ASSERT_EQ(path.size(), 3u);
+    EXPECT_EQ(body_of(path.front()), "1");
+    EXPECT_EQ(body_of(path.back()), "3");
+
+    // 처리 중 들어온 입력은 같은 이벤트에서 이어서 처리됨
+    EXPECT_FALSE(slot.push(raw("4")));
+    ASSERT_TRUE(slot.take(path));
+    EXPECT_EQ(path.size(), 1u);
+
+    // 비어 있으면 대기 상태가 풀리고, 다음 입력은 새 이벤트를 요구
+    EXPECT_FALSE(slot.take(path));
+    EXPECT_TRUE(slot.push(raw("5")));
+}
+
+/**
+ * 슬롯이 가득 차면 새 입력이 버려지고, 보관된 경로는 끊기지 않고 남는지 확인
+ */
+TEST(MoveInputSlotTest, DropsNewInputWhenFull) {
+    MoveInputSlot slot(2);
+
+    slot.push(raw("1"));
+    slot.push(raw("2"));
+    slot.push(raw("3"));
+
+    std::vector<RawMoveInput> path;
+    ASSERT_TRUE(slot.take(path));
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(body_of(path.front()), "1");
+    EXPECT_EQ(body_of(path.back()), "2");
+    EXPECT_EQ(slot.dropped_count(), 1u);
+
+    // 비운 뒤에는 다시 보관
+    slot.push(raw("4"));
+    ASSERT_TRUE(slot.take(path));
+    ASSERT_EQ(path.size(), 1u);
+    EXPECT_EQ(body_of(path.front()), "4");
+}
+
+/**
+ * 버퍼 전용 모드(고정 스텝 시뮬레이션)에서는 이벤트를 요구하지 않고,
+ * 입력은 스텝이 꺼내갈 때까지 순서대로 쌓이는지 확인
+ */
+TEST(MoveInputSlotTest, BufferOnlyNeverSchedules) {
+    MoveInputSlot slot;
+    slot.set_buffer_only(true);
+
+    EXPECT_FALSE(slot.push(raw("1")));
+    EXPECT_FALSE(slot.push(raw("2")));
+
+    std::vector<RawMoveInput> path;
+    ASSERT_TRUE(slot.take(path));
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(body_of(path.back()), "2");
+
+    EXPECT_FALSE(slot.take(path));
+    EXPECT_FALSE(slot.push(raw("3")));
+}
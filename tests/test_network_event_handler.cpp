@@ -0,0 +1,280 @@
+#include <gtest/gtest.h>
+#include "handler_test_support.hpp"
+#include "network_event_handler.hpp"
+
+using namespace test_support;
+
+/**
+ * 게임 중 LEFT: 방에서 빠지고 같은 맵 플레이어에게 퇴장 통지, 남은 플레이어가 있으면 방 유지
+ * 마지막 플레이어 CLOSE: 남은 플레이어가 없으므로 방 즉시 제거
+ */
+TEST(NetworkEventHandlerTest, LeaveRoomRemovesEmptyRoom) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler game_handler(gm, io);
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, game_handler, {&a, &b});
+    ASSERT_TRUE(room);
+    a.read_frames();
+    b.read_frames();
+
+    handler.handle_event(a.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::LEFT)));
+    auto left = frames_of(a.read_frames(), static_cast<uint16_t>(NetworkSubType::LEFT));
+    ASSERT_EQ(left.size(), 1u);
+    EXPECT_EQ(left[0].body["message"], "left the room");
+
+    auto come_out = frames_of(b.read_frames(), GameSubType::PLAYER_COME_OUT_MAP);
+    ASSERT_EQ(come_out.size(), 1u);
+    EXPECT_EQ(come_out[0].body["player_id"], a.player->id_);
+    EXPECT_EQ(room->present_count(), 1u);
+    EXPECT_EQ(gm.find_room(room->id_), room);
+
+    handler.handle_event(b.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::CLOSE)));
+    EXPECT_EQ(gm.find_room(room->id_), nullptr);
+}
+
+/**
+ * 남은 플레이어가 모두 도착한 상태에서 이탈하면 GAME_END 요청 (방은 GAME_END 처리 때 제거)
+ */
+TEST(NetworkEventHandlerTest, LeaveRoomEndsGameWhenOthersFinished) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler game_handler(gm, io);
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, game_handler, {&a, &b});
+    ASSERT_TRUE(room);
+    room->record_player_finished(*b.player);
+
+    handler.handle_event(a.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::LEFT)));
+    EXPECT_EQ(gm.find_room(room->id_), room);
+    EXPECT_FALSE(room->mark_ending()); // 이미 GAME_END 요청됨
+}
+
+namespace {
+
+Event heartbeat_event()
+{
+    Event ev;
+    ev.main_type = MainEventType::NETWORK;
+    ev.sub_type = static_cast<uint16_t>(NetworkSubType::HEARTBEAT);
+    return ev;
+}
+
+} // namespace
+
+/**
+ * 하트비트: PING 을 보내고, 같은 seq 의 PONG 이 올 때까지는 다음 점검에서 PING 을 다시 보내지 않음
+ * PONG 을 받으면 RTT 샘플 반영 후 다음 점검에서 새 seq 로 PING
+ */
+TEST(NetworkEventHandlerTest, HeartbeatWaitsForPong) {
+    init_runtime();
+    auto config = two_player_config();
+    config.heartbeat_interval_ms = 1000;
+    boost::asio::io_context io;
+    GameManager gm(config);
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a");
+
+    handler.handle_event(heartbeat_event());
+    auto pings = frames_of(a.read_frames(), static_cast<uint16_t>(NetworkSubType::PING));
+    ASSERT_EQ(pings.size(), 1u);
+    uint32_t seq = pings[0].body["seq"];
+
+    handler.handle_event(heartbeat_event());
+    EXPECT_TRUE(frames_of(a.read_frames(), static_cast<uint16_t>(NetworkSubType::PING)).empty());
+
+    handler.handle_event(a.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::PONG), pings[0].body.dump()));
+    EXPECT_TRUE(a.conn->rtt().has_sample());
+
+    handler.handle_event(heartbeat_event());
+    pings = frames_of(a.read_frames(), static_cast<uint16_t>(NetworkSubType::PING));
+    ASSERT_EQ(pings.size(), 1u);
+    EXPECT_EQ(pings[0].body["seq"], seq + 1);
+}
+
+/**
+ * 유휴 감지: idle_timeout_ms 동안 아무것도 받지 못한 커넥션은 소켓을 닫음 (PING 은 보내지 않음)
+ */
+TEST(NetworkEventHandlerTest, HeartbeatClosesIdleConnection) {
+    init_runtime();
+    auto config = two_player_config();
+    config.heartbeat_interval_ms = 1000;
+    config.idle_timeout_ms = 20;
+    boost::asio::io_context io;
+    GameManager gm(config);
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a");
+
+    handler.handle_event(heartbeat_event());
+    a.read_frames();
+    EXPECT_TRUE(a.conn->get_socket().is_open());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(config.idle_timeout_ms + 10));
+    a.conn->touch();
+    handler.handle_event(heartbeat_event());
+    a.read_frames();
+    EXPECT_TRUE(a.conn->get_socket().is_open()); // 수신이 있었으면 유지
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(config.idle_timeout_ms + 10));
+    handler.handle_event(heartbeat_event());
+    EXPECT_TRUE(frames_of(a.read_frames(), static_cast<uint16_t>(NetworkSubType::PING)).empty());
+    EXPECT_FALSE(a.conn->get_socket().is_open());
+}
+
+/**
+ * LEFT 후 이동 입력은 무시: 방 연결이 해제되어 이동 기록 / 브로드캐스트 / 포탈 / 도착 처리 없음
+ * (방 상태에서만 이탈 처리된 플레이어도 핸들러가 입력을 거절)
+ */
+TEST(NetworkEventHandlerTest, MoveAfterLeftIsIgnored) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler game_handler(gm, io);
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto room = make_room(gm, game_handler, {&a, &b});
+    ASSERT_TRUE(room);
+    auto map_a = room->get_map_by_name("A");
+    const Point start = room->player_position(*a.player);
+
+    handler.handle_event(a.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::LEFT)));
+    EXPECT_EQ(a.player->room_id(), 0u);
+    EXPECT_FALSE(room->is_player_active(*a.player));
+    EXPECT_EQ(a.player->current_map(), nullptr);
+    b.read_frames();
+
+    move(game_handler, a, open_neighbor(*map_a, start), 1);
+    EXPECT_TRUE(frames_of(b.read_frames(), GameSubType::PLAYER_MOVED).empty());
+
+    // 방 상태에서만 빠진 경우 (방 연결은 남아있음) → 비활성 행이므로 거절
+    room->remove_player(b.player);
+    move(game_handler, b, open_neighbor(*map_a, room->player_position(*b.player)), 1);
+    EXPECT_EQ(b.player->room_id(), room->id_);
+    EXPECT_EQ(room->player_distance(*b.player), 0);
+    EXPECT_TRUE(room->gr_.to_json()["results"].empty());
+}
+
+/**
+ * LEFT 와 이동 처리가 서로 다른 스레드에서 동시에 실행돼도
+ * 방 연결(방 id / 현재 맵)은 잠금 하에서 바뀌므로 이탈 후 상태가 일관되고, 이후 입력은 무시됨
+ */
+TEST(NetworkEventHandlerTest, LeaveRacesWithMove) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler game_handler(gm, io);
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a"), b(io, "b");
+
+    auto& cm = ConnectionManager::get_instance();
+    for (int round = 0; round < 20; ++round) {
+        // LEFT 로 해제된 커넥션 등록 복구 (다음 라운드도 커넥션으로 플레이어를 찾도록)
+        cm.register_connection(a.player, a.conn);
+        cm.register_connection(b.player, b.conn);
+        auto room = make_room(gm, game_handler, {&a, &b});
+        ASSERT_TRUE(room);
+        auto map_a = room->get_map_by_name("A");
+        const Point start = room->player_position(*a.player);
+        const Point next = open_neighbor(*map_a, start);
+
+        std::thread mover([&] {
+            for (uint32_t seq = 1; seq <= 100; ++seq) {
+                move(game_handler, a, seq % 2 ? next : start, seq);
+            }
+        });
+        handler.handle_event(a.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::LEFT)));
+        mover.join();
+
+        EXPECT_EQ(a.player->room_id(), 0u);
+        EXPECT_EQ(a.player->current_map(), nullptr);
+        EXPECT_FALSE(room->is_player_active(*a.player));
+        EXPECT_EQ(map_a->find_player(a.player->handle_), nullptr);
+
+        // 남은 b 도 떠나면 방 제거 → 다음 라운드에서 둘 다 새 방으로
+        handler.handle_event(b.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::LEFT)));
+        EXPECT_EQ(gm.find_room(room->id_), nullptr);
+        a.read_frames();
+        b.read_frames();
+    }
+}
+
+/**
+ * 이미 JOIN 한 커넥션의 JOIN 은 거절: 새 플레이어를 만들거나 대기열에 넣지 않고,
+ * 기존 플레이어의 등록(슬롯 / 송신 세션)은 그대로 유지
+ */
+TEST(NetworkEventHandlerTest, SecondJoinOnConnectionIsRejected) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a");
+    auto& cm = ConnectionManager::get_instance();
+
+    const std::string join = nlohmann::json{{"player_name", "again"}}.dump();
+    handler.handle_event(a.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::JOIN), join));
+
+    auto frames = a.read_frames();
+    EXPECT_TRUE(frames_of(frames, static_cast<uint16_t>(NetworkSubType::JOIN)).empty());
+    auto errors = frames_of(frames, static_cast<uint16_t>(ErrorSubType::UNKNOWN));
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].body["message"], "already joined");
+    EXPECT_EQ(gm.waiting_count(), 0u);
+    EXPECT_EQ(cm.get_player_for_connection(a.conn), a.player);
+    EXPECT_EQ(a.conn->get_player(), a.player);
+    EXPECT_EQ(a.player->get_connection(), a.conn);
+
+    // 다른 플레이어로 직접 등록해도 거절, 같은 플레이어 재등록은 허용
+    EXPECT_FALSE(cm.register_connection(std::make_shared<Player>("other"), a.conn));
+    EXPECT_TRUE(cm.register_connection(a.player, a.conn));
+}
+
+/**
+ * LEFT 후 같은 커넥션으로 다시 JOIN: 이전 플레이어 등록이 해제되어 새 플레이어로 대기열에 들어감
+ * (대기열에서 빠진 경우 / 게임 중 방을 떠난 경우 모두)
+ */
+TEST(NetworkEventHandlerTest, JoinAgainAfterLeft) {
+    init_runtime();
+    boost::asio::io_context io;
+    GameManager gm(two_player_config());
+    GameEventHandler game_handler(gm, io);
+    NetworkEventHandler handler(gm);
+    TestClient a(io, "a"), b(io, "b");
+    auto& cm = ConnectionManager::get_instance();
+    const std::string join = nlohmann::json{{"player_name", "again"}}.dump();
+
+    auto rejoin = [&](TestClient& c) {
+        handler.handle_event(c.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::JOIN), join));
+        auto joined = frames_of(c.read_frames(), static_cast<uint16_t>(NetworkSubType::JOIN));
+        EXPECT_EQ(joined.size(), 1u);
+        auto player = c.conn->get_player();
+        EXPECT_TRUE(player && player != c.player);
+        if (player) {
+            gm.remove_waiting_player(player);
+            cm.unregister_connection(player);
+        }
+    };
+
+    // 대기열에서 LEFT → JOIN
+    gm.add_waiting_player(a.player);
+    handler.handle_event(a.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::LEFT)));
+    EXPECT_EQ(cm.get_player_for_connection(a.conn), nullptr);
+    a.read_frames();
+    rejoin(a);
+    EXPECT_EQ(gm.waiting_count(), 0u);
+
+    // 게임 중 LEFT → JOIN
+    cm.register_connection(a.player, a.conn);
+    auto room = make_room(gm, game_handler, {&a, &b});
+    ASSERT_TRUE(room);
+    handler.handle_event(b.event(MainEventType::NETWORK, static_cast<uint16_t>(NetworkSubType::LEFT)));
+    EXPECT_EQ(b.conn->get_player(), nullptr);
+    b.read_frames();
+    rejoin(b);
+}
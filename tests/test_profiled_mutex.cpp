@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "profiled_mutex.hpp"
+#include "metrics.hpp"
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <thread>
+
+/**
+ * 켜져 있을 때만 획득/경합/보유 시간이 이름별 지표로 기록되고,
+ * 같은 이름의 뮤텍스는 통계를 공유하는지 확인
+ */
+TEST(ProfiledMutexTest, RecordsContentionPerName) {
+    ProfiledMutex a("test_lock");
+    ProfiledMutex b("test_lock");
+
+    auto& reg = MetricsRegistry::get_instance();
+    auto& acquisitions = reg.counter("asio_server_mutex_acquisitions_total", "", "mutex=\"test_lock\"");
+    auto& contended = reg.counter("asio_server_mutex_contended_total", "", "mutex=\"test_lock\"");
+    auto& hold_ns = reg.histogram("asio_server_mutex_hold_ns", "", "mutex=\"test_lock\"");
+
+    // 꺼져 있으면 기록하지 않음
+    { std::lock_guard<ProfiledMutex> lock(a); }
+    EXPECT_EQ(acquisitions.value(), 0u);
+
+    ProfiledMutex::set_enabled(true);
+    { std::lock_guard<ProfiledMutex> lock(a); }
+    ASSERT_TRUE(b.try_lock());
+    b.unlock();
+    EXPECT_EQ(acquisitions.value(), 2u);
+    EXPECT_EQ(hold_ns.count(), 2u);
+    EXPECT_EQ(contended.value(), 0u);
+
+    // 다른 스레드가 잡고 있는 동안 획득 → 경합 1회
+    std::unique_lock<ProfiledMutex> held(a);
+    std::thread waiter([&a]() { std::lock_guard<ProfiledMutex> lock(a); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    held.unlock();
+    waiter.join();
+    ProfiledMutex::set_enabled(false);
+
+    EXPECT_EQ(contended.value(), 1u);
+    EXPECT_EQ(acquisitions.value(), 4u);
+
+    auto report = nlohmann::json::parse(ProfiledMutex::report_json());
+    bool found = false;
+    for (const auto& entry : report["locks"]) {
+        if (entry["mutex"] == "test_lock") {
+            found = true;
+            EXPECT_EQ(entry["contended"], 1);
+            EXPECT_GT(entry["wait_total_ns"].get<uint64_t>(), 0u);
+        }
+    }
+    EXPECT_TRUE(found);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "room.hpp"
+#include "game_manager.hpp"
+#include "handler_test_support.hpp"
+
+using test_support::kMapSeed;
+
+/**
+ * 방 단위 틱 스냅샷: 맵별로 나뉘고, 한 번 가져간 변경분은 다음 틱에 다시 나오지 않는지 확인
+ * (맵 이동처럼 mark_dirty=false 로 기록한 상태 변경은 스냅샷에 포함되지 않음)
+ */
+TEST(RoomTest, TakeDirtySnapshotAcrossTicks) {
+    Room room(1);
+    room.initialize_maps(kMapSeed);
+    auto map_a = room.get_map_by_name("A");
+    auto map_b = room.get_map_by_name("B");
+
+    auto a = std::make_shared<Player>("a");
+    auto b = std::make_shared<Player>("b");
+    ASSERT_TRUE(room.join_player(a));
+    ASSERT_TRUE(room.join_player(b));
+
+    // 틱 1: a 이동
+    room.record_player_move(*a, *map_a, {1, 2}, 1, 0, true);
+    auto tick1 = room.take_dirty_snapshot(*map_a);
+    ASSERT_EQ(tick1.size(), 1u);
+    EXPECT_EQ(tick1[0].info["player_id"], a->id_);
+    EXPECT_TRUE(room.take_dirty_snapshot(*map_b).empty());
+
+    // 틱 2: b 이동, a 는 맵 B 로 이동 (입장 통지로 따로 전송)
+    room.record_player_move(*b, *map_a, {2, 1}, 1, 0, true);
+    room.record_player_move(*a, *map_b, map_b->start_point, 1, 0, false);
+    auto tick2 = room.take_dirty_snapshot(*map_a);
+    ASSERT_EQ(tick2.size(), 1u);
+    EXPECT_EQ(tick2[0].info["player_id"], b->id_);
+    EXPECT_EQ(tick2[0].position, (Point{2, 1}));
+    EXPECT_TRUE(room.take_dirty_snapshot(*map_b).empty());
+
+    // 틱 3: 변경 없음
+    EXPECT_TRUE(room.take_dirty_snapshot(*map_a).empty());
+
+    // 방 상태가 위치/이동 거리의 원본
+    EXPECT_EQ(room.player_position(*a), map_b->start_point);
+    EXPECT_EQ(room.player_distance(*a), 2);
+    EXPECT_EQ(room.players_position_info(*map_a).size(), 1u);
+}
+
+/**
+ * 방 전용 풀은 방마다 pthread key 를 쓰지 않으므로, PTHREAD_KEYS_MAX(1024) 보다 많은 방을 동시에 만들 수 있음
+ */
+TEST(RoomTest, CreatesMoreRoomsThanPthreadKeys) {
+    GameManager gm;
+    std::vector<std::shared_ptr<Room>> rooms;
+    for (int i = 0; i < 1100; ++i) {
+        ASSERT_NO_THROW(rooms.push_back(gm.create_room())) << "room " << i;
+    }
+    rooms.back()->initialize_maps(kMapSeed);
+    EXPECT_EQ(rooms.back()->get_maps().size(), 3u);
+    EXPECT_EQ(gm.get_all_rooms().size(), 1100u);
+}
+
+/**
+ * 맵은 방 풀에서 할당되지만, 방이 먼저 해제되어도 맵을 계속 쓸 수 있음 (풀 소유권 공유)
+ */
+TEST(RoomTest, MapOutlivesRoom) {
+    std::shared_ptr<Map> map;
+    {
+        auto room = std::make_shared<Room>(1);
+        room->initialize_maps(kMapSeed);
+        map = room->get_map_by_name("C");
+    }
+    ASSERT_TRUE(map);
+    EXPECT_TRUE(map->is_end_map());
+    EXPECT_TRUE(map->is_valid_position(map->start_point));
+    map.reset();
+}
+
+/**
+ * 고정 맵 시드: 같은 시드면 방이 달라도 포탈/장애물이 같음
+ */
+TEST(RoomTest, SameMapSeedBuildsSameMaps) {
+    Room a(1), b(2);
+    a.initialize_maps(7);
+    b.initialize_maps(7);
+    for (const char* name : {"A", "B", "C"}) {
+        auto ma = a.get_map_by_name(name);
+        auto mb = b.get_map_by_name(name);
+        ASSERT_EQ(ma->obstacles_.size(), mb->obstacles_.size()) << name;
+        for (std::size_t i = 0; i < ma->obstacles_.size(); ++i) {
+            EXPECT_EQ(ma->obstacles_[i].position, mb->obstacles_[i].position);
+        }
+        ASSERT_EQ(ma->portals_.size(), mb->portals_.size());
+        for (std::size_t i = 0; i < ma->portals_.size(); ++i) {
+            EXPECT_EQ(ma->portals_[i].position, mb->portals_[i].position);
+        }
+    }
+}
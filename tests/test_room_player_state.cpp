@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "room_player_state.hpp"
+
+/**
+ * 도착 확인은 방에 남은 플레이어만 대상으로 하고,
+ * 틱 스냅샷은 해당 맵에서 이동한 플레이어만 한 번씩 포함하는지 확인
+ */
+TEST(RoomPlayerStateTest, FinishedAndDirtySnapshot) {
+    RoomPlayerState state;
+
+    auto a = std::make_shared<Player>("a");
+    auto b = std::make_shared<Player>("b");
+    int ia = state.add(a, 0, {1, 1});
+    int ib = state.add(b, 0, {1, 1});
+    EXPECT_EQ(state.index_of(*a), ia);
+    EXPECT_EQ(state.index_of(*b), ib);
+    EXPECT_EQ(state.index_of(Player("c")), -1); // 입장하지 않은 플레이어
+    EXPECT_FALSE(state.all_finished());
+
+    // a 이동 → 맵 0 스냅샷에만 포함
+    state.move(ia, 0, {2, 3}, 3, 0);
+    state.set_dirty(ia);
+    EXPECT_EQ(state.distance(ia), 3);
+    EXPECT_TRUE(state.take_dirty(1).empty());
+    auto snaps = state.take_dirty(0);
+    ASSERT_EQ(snaps.size(), 1u);
+    EXPECT_EQ(snaps[0].position, (Point{2, 3}));
+    EXPECT_EQ(snaps[0].info["player_id"], a->id_);
+    EXPECT_TRUE(state.take_dirty(0).empty());
+
+    // a 도착, b 이탈 → 모두 완료
+    state.set_finished(ia);
+    EXPECT_FALSE(state.all_finished());
+    state.set_active(ib, false);
+    EXPECT_TRUE(state.all_finished());
+    EXPECT_EQ(state.index_of(*b), ib); // 이탈해도 행은 유지
+    EXPECT_EQ(state.active_players().size(), 1u);
+}
+
+/**
+ * 틱마다 변경분만: 두 번째 틱에는 그 사이 다시 이동한 플레이어만, 마지막 적용 seq 와 함께 포함
+ */
+TEST(RoomPlayerStateTest, DirtySnapshotAcrossTicks) {
+    RoomPlayerState state;
+
+    auto a = std::make_shared<Player>("a");
+    auto b = std::make_shared<Player>("b");
+    int ia = state.add(a, 0, {1, 1});
+    int ib = state.add(b, 0, {1, 1});
+
+    // 틱 1: 둘 다 이동
+    state.move(ia, 0, {1, 2}, 1, 0);
+    state.set_dirty(ia);
+    state.move(ib, 0, {2, 1}, 1, 0);
+    state.set_dirty(ib);
+    EXPECT_EQ(state.take_dirty(0).size(), 2u);
+
+    // 틱 2: b 만 다시 이동 (seq 포함)
+    state.move(ib, 0, {3, 1}, 1, 5);
+    state.set_dirty(ib);
+    auto snaps = state.take_dirty(0);
+    ASSERT_EQ(snaps.size(), 1u);
+    EXPECT_EQ(snaps[0].info["player_id"], b->id_);
+    EXPECT_EQ(snaps[0].position, (Point{3, 1}));
+    EXPECT_EQ(snaps[0].info["seq"], 5);
+
+    // 틱 3: 변경 없음 (seq 0 인 이동 입력은 마지막 seq 를 지우지 않음)
+    EXPECT_TRUE(state.take_dirty(0).empty());
+    state.move(ib, 0, {3, 2}, 1, 0);
+    EXPECT_EQ(state.seq(ib), 5u);
+    EXPECT_EQ(state.distance(ib), 3);
+}
+
+/**
+ * 맵별 위치 목록: 그 맵에 남아있고 도착하지 않은 플레이어만
+ */
+TEST(RoomPlayerStateTest, PositionsInMap) {
+    RoomPlayerState state;
+
+    auto a = std::make_shared<Player>("a");
+    auto b = std::make_shared<Player>("b");
+    auto c = std::make_shared<Player>("c");
+    int ia = state.add(a, 0, {1, 1});
+    int ib = state.add(b, 0, {1, 1});
+    int ic = state.add(c, 0, {1, 1});
+
+    state.move(ib, 1, {4, 4}, 1, 0);
+    state.set_active(ic, false);
+
+    auto in_a = state.positions_in_map(0);
+    ASSERT_EQ(in_a.size(), 1u);
+    EXPECT_EQ(in_a[0]["player_id"], a->id_);
+    auto in_b = state.players_in_map(1);
+    ASSERT_EQ(in_b.size(), 1u);
+    EXPECT_EQ(in_b[0]["name"], "b");
+    EXPECT_EQ(in_b[0]["position"]["x"], 4);
+
+    state.set_finished(ib);
+    EXPECT_TRUE(state.positions_in_map(1).empty());
+    EXPECT_EQ(state.position(ia), (Point{1, 1}));
+}
+
+/**
+ * 지형 스트리밍 전송 기록: 플레이어/맵별로 각 청크를 한 번만 반환
+ */
+TEST(RoomPlayerStateTest, TakeUnsentChunksOncePerPlayerAndMap) {
+    RoomPlayerState state;
+
+    auto a = std::make_shared<Player>("a");
+    auto b = std::make_shared<Player>("b");
+    int ia = state.add(a, 0, {1, 1});
+    int ib = state.add(b, 0, {1, 1});
+
+    EXPECT_EQ(state.take_unsent_chunks(ia, 0, 6, {0, 1, 3, 1}), (std::vector<int>{0, 1, 3}));
+    EXPECT_EQ(state.take_unsent_chunks(ia, 0, 6, {1, 2, 4}), (std::vector<int>{2, 4}));
+    EXPECT_TRUE(state.take_unsent_chunks(ia, 0, 6, {0, 4}).empty());
+
+    // 다른 맵 / 다른 플레이어는 따로 기록
+    EXPECT_EQ(state.take_unsent_chunks(ia, 2, 4, {0}), (std::vector<int>{0}));
+    EXPECT_EQ(state.take_unsent_chunks(ib, 0, 6, {0, 1}), (std::vector<int>{0, 1}));
+}
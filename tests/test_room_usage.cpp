@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include "room_usage.hpp"
+
+/**
+ * 구간 합계는 window_ms 가 지나면 빠지고 (누적은 유지),
+ * 입력 예산을 넘긴 동안만 입력을 거절하는지 확인
+ */
+TEST(RoomUsageTest, RollingWindowBudget) {
+    RoomUsage usage;
+    RoomUsage::Budget budget;
+    budget.window_ms = 1000; // 100ms 칸 x 10
+    budget.msgs_in = 3;
+    usage.set_budget(budget);
+
+    EXPECT_TRUE(usage.admit_input(10, 0));
+    EXPECT_TRUE(usage.admit_input(10, 100));
+    EXPECT_TRUE(usage.admit_input(10, 200));
+    EXPECT_FALSE(usage.throttled());
+
+    // 4번째 입력: 예산 초과 → 거절
+    EXPECT_FALSE(usage.admit_input(10, 300));
+    EXPECT_TRUE(usage.throttled());
+    EXPECT_EQ(usage.throttled_inputs(), 1u);
+
+    usage.add_handler(2500000, 4, 400, 300);
+    auto window = usage.window_totals(300);
+    EXPECT_EQ(window.msgs_in, 4u);
+    EXPECT_EQ(window.bytes_in, 40u);
+    EXPECT_EQ(window.cpu_us, 2500u);
+    EXPECT_EQ(window.msgs_out, 4u);
+    EXPECT_EQ(window.bytes_out, 400u);
+
+    // 앞의 두 칸(0ms, 100ms)이 구간에서 빠지면 다시 허용
+    EXPECT_TRUE(usage.admit_input(10, 1150));
+    EXPECT_FALSE(usage.throttled());
+    EXPECT_EQ(usage.window_totals(1150).msgs_in, 3u);
+    EXPECT_EQ(usage.lifetime_totals().msgs_in, 5u);
+}
+
+// Scope 구간에서 보낸 메시지만 방 송신량에 반영
+TEST(RoomUsageTest, ScopeCountsOutput) {
+    RoomUsage usage;
+    RoomUsage::count_output(100); // 구간 밖: 무시
+    {
+        RoomUsage::Scope scope(&usage);
+        RoomUsage::count_output(30);
+        RoomUsage::count_output(20);
+        {
+            RoomUsage::Scope none(nullptr);
+            RoomUsage::count_output(5);
+        }
+    }
+    RoomUsage::count_output(100);
+
+    auto total = usage.lifetime_totals();
+    EXPECT_EQ(total.msgs_out, 3u);
+    EXPECT_EQ(total.bytes_out, 55u);
+}
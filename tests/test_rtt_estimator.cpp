@@ -0,0 +1,27 @@
+#include <gtest/gtest.h>
+#include "rtt_estimator.hpp"
+
+/**
+ * 첫 샘플은 그대로 평균이 되고,
+ * 이후 샘플은 1/8 가중치로만 반영되는지 확인 (튀는 값 하나로 평균이 크게 흔들리지 않음)
+ */
+TEST(RttEstimatorTest, SmoothsSamples) {
+    RttEstimator rtt;
+    EXPECT_FALSE(rtt.has_sample());
+
+    rtt.add_sample(40);
+    EXPECT_TRUE(rtt.has_sample());
+    EXPECT_DOUBLE_EQ(rtt.srtt_ms(), 40);
+    EXPECT_DOUBLE_EQ(rtt.rttvar_ms(), 20);
+
+    rtt.add_sample(120);
+    EXPECT_DOUBLE_EQ(rtt.srtt_ms(), 50);          // 40 * 7/8 + 120 * 1/8
+    EXPECT_DOUBLE_EQ(rtt.rttvar_ms(), 35);        // 20 * 3/4 + |40 - 120| * 1/4
+    EXPECT_DOUBLE_EQ(rtt.last_ms(), 120);
+    EXPECT_EQ(rtt.sample_count(), 2u);
+
+    // 같은 값이 계속 들어오면 평균은 그 값으로 수렴
+    for (int i = 0; i < 100; ++i) rtt.add_sample(10);
+    EXPECT_NEAR(rtt.srtt_ms(), 10, 0.01);
+    EXPECT_NEAR(rtt.rttvar_ms(), 0, 0.01);
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include "slot_map.hpp"
+#include <string>
+
+/**
+ * 제거된 슬롯이 재사용되면 세대가 바뀌어
+ * 예전 핸들로는 새 값에 접근할 수 없는지 확인
+ */
+TEST(SlotMapTest, StaleHandleAfterReuse) {
+    SlotMap<std::string> slots;
+
+    SlotHandle a = slots.insert("a");
+    SlotHandle b = slots.insert("b");
+    ASSERT_NE(slots.get(a), nullptr);
+    EXPECT_EQ(*slots.get(b), "b");
+    EXPECT_NE(a.value(), 0u);
+
+    EXPECT_TRUE(slots.erase(a));
+    EXPECT_FALSE(slots.erase(a));
+    EXPECT_EQ(slots.get(a), nullptr);
+
+    // 같은 인덱스 재사용, 세대는 다름
+    SlotHandle c = slots.insert("c");
+    EXPECT_EQ(c.index, a.index);
+    EXPECT_NE(c.generation, a.generation);
+    EXPECT_EQ(slots.get(a), nullptr);
+    EXPECT_EQ(*slots.get(c), "c");
+
+    // 정수 값으로 왕복 가능 (프로토콜/이벤트 전달용)
+    EXPECT_EQ(SlotHandle::from_value(c.value()), c);
+    EXPECT_EQ(slots.size(), 2u);
+    EXPECT_FALSE(slots.contains(SlotHandle{}));
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "spatial_grid.hpp"
+#include <algorithm>
+
+namespace {
+
+bool contains(const std::vector<std::shared_ptr<Player>>& players, const std::shared_ptr<Player>& p) {
+    return std::find(players.begin(), players.end(), p) != players.end();
+}
+
+} // anonymous namespace
+
+/**
+ * 시야 반경(체비셰프 거리) 이내의 플레이어만 조회되는지 확인
+ */
+TEST(SpatialGridTest, QueryReturnsPlayersInRadius) {
+    SpatialGrid grid(30, 30, 3);
+    auto a = std::make_shared<Player>("A");
+    auto b = std::make_shared<Player>("B");
+    auto c = std::make_shared<Player>("C");
+
+    grid.insert(a, {5, 5});
+    grid.insert(b, {8, 8});   // 대각선 거리 3
+    grid.insert(c, {9, 5});   // 거리 4
+
+    auto near = grid.query({5, 5}, 3);
+    EXPECT_TRUE(contains(near, a));
+    EXPECT_TRUE(contains(near, b));
+    EXPECT_FALSE(contains(near, c));
+}
+
+/**
+ * 셀 경계를 넘는 이동과 제거가 색인에 반영되는지 확인
+ */
+TEST(SpatialGridTest, MoveAndRemoveUpdateIndex) {
+    SpatialGrid grid(30, 30, 3);
+    auto a = std::make_shared<Player>("A");
+
+    grid.insert(a, {1, 1});
+    grid.move(a, {20, 20});
+
+    EXPECT_TRUE(grid.query({1, 1}, 3).empty());
+    EXPECT_TRUE(contains(grid.query({19, 21}, 3), a));
+    EXPECT_EQ(grid.position_of(a), (Point{20, 20}));
+
+    grid.remove(a);
+    EXPECT_TRUE(grid.query({20, 20}, 3).empty());
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include "timing_wheel.hpp"
+
+/**
+ * 상위 단계로 배치된 타이머도 정확한 틱에 만료되고,
+ * 같은 틱에 만료되는 타이머는 한 번에 모여서 반환되는지 확인
+ */
+TEST(TimingWheelTest, FiresAtExactTickAcrossLevels) {
+    TimingWheel wheel(100);
+    std::vector<uint64_t> fired;
+
+    for (uint64_t delay : {1u, 63u, 64u, 65u, 5000u, 300000u}) {
+        wheel.schedule(delay, [&fired, &wheel]() { fired.push_back(wheel.current_tick()); });
+    }
+
+    std::vector<TimingWheel::Callback> due;
+    for (uint64_t t = 101; t <= 100 + 300000; ++t) {
+        wheel.advance_to(t, due);
+        for (auto& cb : due) {
+            cb();
+        }
+        due.clear();
+    }
+
+    std::vector<uint64_t> expected{101, 163, 164, 165, 5100, 300100};
+    EXPECT_EQ(fired, expected);
+    EXPECT_TRUE(wheel.empty());
+}
+
+/**
+ * 취소된 타이머는 만료되지 않고, 여러 틱을 한 번에 지나도 모두 모아서 반환되는지 확인
+ */
+TEST(TimingWheelTest, CancelAndBatch) {
+    TimingWheel wheel;
+    int count = 0;
+    auto a = wheel.schedule(10, [&count]() { count += 1; });
+    wheel.schedule(10, [&count]() { count += 10; });
+    wheel.schedule(200, [&count]() { count += 100; });
+
+    EXPECT_TRUE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(a));
+
+    std::vector<TimingWheel::Callback> due;
+    wheel.advance_to(1000, due);
+    ASSERT_EQ(due.size(), 2u);
+    for (auto& cb : due) {
+        cb();
+    }
+    EXPECT_EQ(count, 110);
+    EXPECT_EQ(wheel.current_tick(), 1000u);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include "tracer.hpp"
+#include <nlohmann/json.hpp>
+
+/**
+ * 구간 안에서 현재 trace id 가 이어지고 (중첩 구간은 0을 넘기면 상속),
+ * dump 결과가 Chrome trace 형식 JSON 인지 확인
+ */
+TEST(TracerTest, RecordsSpansAsChromeTrace) {
+    auto& tracer = Tracer::get_instance();
+    tracer.clear();
+
+    // 꺼져 있으면 기록하지 않음
+    { TRACE_SPAN("ignored", 1); }
+    EXPECT_EQ(tracer.span_count(), 0u);
+
+    tracer.set_enabled(true);
+    uint64_t id = tracer.next_trace_id();
+    {
+        TraceSpan outer("game_handler", 204, id);
+        EXPECT_EQ(Tracer::current_trace_id(), id);
+        TRACE_SPAN("broadcast_in_map", 0);
+        TRACE_INSTANT("enqueue", id);
+    }
+    EXPECT_EQ(Tracer::current_trace_id(), 0u);
+    tracer.set_enabled(false);
+
+    auto trace = nlohmann::json::parse(tracer.dump_chrome_json(true));
+    ASSERT_EQ(trace["traceEvents"].size(), 3u);
+    for (const auto& ev : trace["traceEvents"]) {
+        EXPECT_EQ(ev["args"]["trace_id"], id);
+    }
+    EXPECT_EQ(trace["traceEvents"][0]["ph"], "i");
+    EXPECT_EQ(trace["traceEvents"][1]["name"], "broadcast_in_map");
+    EXPECT_EQ(trace["traceEvents"][2]["name"], "game_handler 204");
+    EXPECT_EQ(trace["traceEvents"][2]["ph"], "X");
+    EXPECT_EQ(tracer.span_count(), 0u);
+}